@@ -1,5 +1,6 @@
 import os
 import sys
+import json
 import numpy as np
 import netCDF4 as nc
 import xarray as xr
@@ -171,6 +172,56 @@ class dataplane(logger):
 
       ds.close()
 
+   ##
+   ##  Raw binary transport for MET_PYTHON_EXE: the array is written in
+   ##  the .npy layout followed by a JSON trailer holding the attributes.
+   ##  The reader memory maps the array instead of decoding NetCDF.
+   ##
+
+   @staticmethod
+   def _json_attr(attr_val):
+      if isinstance(attr_val, np.generic):
+         return attr_val.item()
+      return str(attr_val)
+
+   @staticmethod
+   def write_dataplane_raw(met_in, raw_filename):
+      met_data = met_in.met_data
+      if hasattr(met_data, 'attrs') and met_data.attrs:
+         attrs = met_data.attrs
+      else:
+         attrs = met_in.attrs
+      if dataplane.is_xarray_dataarray(met_data):
+         met_data = met_data.data
+      if isinstance(met_data, np.ma.MaskedArray):
+         met_data = met_data.filled(dataplane.MET_FILL_VALUE)
+      met_data = np.ascontiguousarray(met_data)
+
+      met_attrs = { attr: attr_val for attr, attr_val in attrs.items()
+                    if attr_val is not None }
+
+      with open(raw_filename, 'wb') as raw_file:
+         np.lib.format.write_array(raw_file, met_data, allow_pickle=False)
+         raw_file.write(json.dumps(met_attrs, default=dataplane._json_attr).encode('utf-8'))
+
+   @staticmethod
+   def read_dataplane_raw(raw_filename):
+      with open(raw_filename, 'rb') as raw_file:
+         version = np.lib.format.read_magic(raw_file)
+         if version == (1, 0):
+            shape, fortran_order, dtype = np.lib.format.read_array_header_1_0(raw_file)
+         else:
+            shape, fortran_order, dtype = np.lib.format.read_array_header_2_0(raw_file)
+         offset = raw_file.tell()
+         data_size = int(np.prod(shape)) * dtype.itemsize
+         raw_file.seek(offset + data_size)
+         met_attrs = json.loads(raw_file.read().decode('utf-8'))
+
+      met_data = np.memmap(raw_filename, dtype=dtype, mode='r', offset=offset,
+                           shape=shape, order='F' if fortran_order else 'C')
+
+      return { 'met_data': met_data, 'attrs': met_attrs }
+
    @staticmethod
    def validate_met_data(met_data, fill_value=None):
       method_name = f"{dataplane.class_name}.validate()"
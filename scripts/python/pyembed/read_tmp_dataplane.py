@@ -11,6 +11,6 @@ import sys
 # PYTHON path for met.dataplane is added by write_tmp_dataplane.py
 from met.dataplane import dataplane
 
-netcdf_filename = sys.argv[1]
-# read NetCDF file
-met_info = dataplane.read_dataplane(netcdf_filename)
+tmp_filename = sys.argv[1]
+# memory map the raw binary file written by write_tmp_dataplane.py
+met_info = dataplane.read_dataplane_raw(tmp_filename)
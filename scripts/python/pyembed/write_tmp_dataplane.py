@@ -6,6 +6,9 @@
 #    usage:  /path/to/python write_tmp_dataplane.py \
 #            tmp_output_filename <user_python_script>.py <args>
 #
+#    The data is written as a raw binary buffer with the attributes
+#    appended (see dataplane.write_dataplane_raw).
+#
 ########################################################################
 
 import sys
@@ -22,6 +25,6 @@ from met.dataplane import dataplane
 #    dataplane.write_dataplane(met_in, netcdf_filename)
 
 if __name__ == '__main__':
-   netcdf_filename = sys.argv[1]
+   tmp_filename = sys.argv[1]
    met_in = pyembed_tools.call_python(sys.argv)
-   dataplane.write_dataplane(met_in, netcdf_filename)
+   dataplane.write_dataplane_raw(met_in, tmp_filename)
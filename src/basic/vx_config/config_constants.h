@@ -1052,6 +1052,7 @@ static const char conf_key_write_pixel_age[] = "write_pixel_age";
 
 static const char conf_key_output_stats[] = "output_stats";
 static const char conf_key_block_size[]   = "block_size";
+static const char conf_key_stream_flag[]  = "stream_flag";
 
 //
 // Plot-Point-Obs specific parameter values names
@@ -21,6 +21,7 @@
 
 #include "config_funcs.h"
 #include "calculator.h"
+#include "celltype_to_string.h"
 #include "configobjecttype_to_string.h"
 
 
@@ -33,6 +34,16 @@ using namespace std;
 extern Calculator hp;
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+static const int user_func_block_size = 256;
+
+static const int max_compile_depth = 16;   //  nested user function calls
+
+static const int max_scalar_nodes = 32;
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -119,6 +130,7 @@ clear();
 Name  = f.Name;
 NArgs = f.NArgs;
 V     = f.V;
+Nodes = f.Nodes;
 
 return;
 
@@ -138,6 +150,8 @@ NArgs = bad_data_int;
 
 V.clear();
 
+Nodes.clear();
+
 return;
 
 }
@@ -178,6 +192,384 @@ NArgs = e->n_args();
 
 V = *(e->icv());
 
+compile();
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  compile the icode into an expression tree with the constant
+   //  subexpressions folded, so that it can be evaluated over whole
+   //  arrays without running the Calculator for each value
+   //
+   //  the integer and floating-point semantics of the Calculator are
+   //  preserved.  If the icode contains anything that can't be
+   //  compiled, Nodes is left empty and the Calculator is used.
+   //
+
+void UserFunc_1Arg::compile()
+
+{
+
+std::vector<int> locals;
+std::vector<int> stack;
+const int args[2] = { 0, 0 };
+
+Nodes.clear();
+
+locals.push_back(add_node(local_var, 0, 0, args));
+
+if ( ! compile_icv(V, locals, stack, 0) || stack.size() != 1 )  {
+
+   Nodes.clear();
+
+   return;
+
+}
+
+   //
+   //  make sure the result is the last node
+   //
+
+if ( stack[0] != (int) Nodes.size() - 1 )  {
+
+   Nodes.push_back(Nodes[stack[0]]);
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+bool UserFunc_1Arg::compile_icv(const IcodeVector & v, const std::vector<int> & locals,
+                                std::vector<int> & stack, int depth)
+
+{
+
+int j, n;
+int args[max_user_function_args];
+Number num;
+
+if ( depth > max_compile_depth )  return false;
+
+for (int pos=0; pos<v.length(); ++pos)  {
+
+   const IcodeCell & cell = v[pos];
+
+   switch ( cell.type )  {
+
+      case integer:
+         set_int(num, cell.i);
+         stack.push_back(add_const(num));
+         break;
+
+      case floating_point:
+         set_double(num, cell.d);
+         stack.push_back(add_const(num));
+         break;
+
+      case op_add:
+      case op_subtract:
+      case op_multiply:
+      case op_divide:
+      case op_power:
+         if ( stack.size() < 2 )  return false;
+         args[1] = stack.back();  stack.pop_back();
+         args[0] = stack.back();  stack.pop_back();
+         stack.push_back(add_node(cell.type, 0, 2, args));
+         break;
+
+      case op_square:
+      case op_negate:
+         if ( stack.empty() )  return false;
+         args[0] = stack.back();  stack.pop_back();
+         stack.push_back(add_node(cell.type, 0, 1, args));
+         break;
+
+      case builtin_func:
+         if ( binfo[cell.i].id == builtin_nint ||
+              binfo[cell.i].id == builtin_sign )  n = 1;
+         else                                     n = binfo[cell.i].n_args;
+         if ( n < 1 || n > max_builtin_args || (int) stack.size() < n )  return false;
+         for (j=n-1; j>=0; --j)  { args[j] = stack.back();  stack.pop_back(); }
+         stack.push_back(add_node(builtin_func, cell.i, n, args));
+         break;
+
+      case user_func:
+         {
+            n = cell.e->n_args();
+            if ( n < 0 || n > max_user_function_args || (int) stack.size() < n )  return false;
+            std::vector<int> sub_locals(n);
+            for (j=n-1; j>=0; --j)  { sub_locals[j] = stack.back();  stack.pop_back(); }
+            if ( ! compile_icv(*(cell.e->icv()), sub_locals, stack, depth + 1) )  return false;
+         }
+         break;
+
+      case local_var:
+         if ( cell.i < 0 || cell.i >= (int) locals.size() )  return false;
+         stack.push_back(locals[cell.i]);
+         break;
+
+      default:
+         return false;
+
+   }   //  switch
+
+}   //  for pos
+
+return true;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int UserFunc_1Arg::add_const(const Number & num)
+
+{
+
+UserFuncNode node;
+
+node.op       = floating_point;
+node.is_int   = num.is_int;
+node.is_const = true;
+node.value    = as_double(num);
+node.builtin  = 0;
+node.arg[0]   = node.arg[1] = 0;
+
+Nodes.push_back(node);
+
+return ( (int) Nodes.size() - 1 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+int UserFunc_1Arg::add_node(CellType op, int builtin, int n_args, const int * args)
+
+{
+
+int j;
+UserFuncNode node;
+bool all_const = ( n_args > 0 );
+
+node.op       = op;
+node.is_const = false;
+node.value    = 0.0;
+node.builtin  = builtin;
+node.arg[0]   = ( n_args > 0 ? args[0] : 0 );
+node.arg[1]   = ( n_args > 1 ? args[1] : 0 );
+
+for (j=0; j<n_args; ++j)  all_const = all_const && Nodes[args[j]].is_const;
+
+   //
+   //  integer valued results, following the Calculator
+   //
+
+const bool int0 = ( n_args > 0 && Nodes[node.arg[0]].is_int );
+const bool int1 = ( n_args > 1 && Nodes[node.arg[1]].is_int );
+
+switch ( op )  {
+
+   case op_add:
+   case op_subtract:
+   case op_multiply:
+   case op_divide:
+      node.is_int = int0 && int1;
+      break;
+
+   case op_square:
+   case op_negate:
+      node.is_int = int0;
+      break;
+
+   case builtin_func:
+      if ( binfo[builtin].id == builtin_nint ||
+           binfo[builtin].id == builtin_sign )  node.is_int = true;
+      else if ( n_args == 1 )                   node.is_int = (binfo[builtin].i1 != nullptr) && int0;
+      else                                      node.is_int = (binfo[builtin].i2 != nullptr) && int0 && int1;
+      break;
+
+   default:
+      node.is_int = false;
+      break;
+
+}
+
+   //
+   //  leave division by a constant zero to be reported at run time
+   //
+
+if ( all_const && op == op_divide && Nodes[node.arg[1]].value == 0.0 )  all_const = false;
+
+   //
+   //  fold constant subexpressions with the Calculator
+   //
+
+if ( all_const )  {
+
+   Calculator c;
+   Number num;
+
+   for (j=0; j<n_args; ++j)  {
+
+      const UserFuncNode & a = Nodes[args[j]];
+
+      if ( a.is_int )  set_int(num, nint(a.value));
+      else             set_double(num, a.value);
+
+      c.push(num);
+
+   }
+
+   switch ( op )  {
+
+      case op_add:       c.do_add();           break;
+      case op_subtract:  c.do_subtract();      break;
+      case op_multiply:  c.do_multiply();      break;
+      case op_divide:    c.do_divide();        break;
+      case op_power:     c.do_power();         break;
+      case op_square:    c.do_square();        break;
+      case op_negate:    c.do_negate();        break;
+      case builtin_func: c.do_builtin(builtin); break;
+      default:           break;
+
+   }
+
+   return ( add_const(c.pop()) );
+
+}
+
+Nodes.push_back(node);
+
+return ( (int) Nodes.size() - 1 );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  evaluate the nodes for n input values, storing the values of
+   //  node j in work[j*n] through work[j*n + n - 1]
+   //
+
+void UserFunc_1Arg::eval_nodes(const double * in, int n, double * work) const
+
+{
+
+int i, j;
+
+for (j=0; j<(int) Nodes.size(); ++j)  {
+
+   const UserFuncNode & node = Nodes[j];
+   double * out = work + j*n;
+   const double * a = work + node.arg[0]*n;
+   const double * b = work + node.arg[1]*n;
+
+   if ( node.is_const )  {
+
+      for (i=0; i<n; ++i)  out[i] = node.value;
+
+      continue;
+
+   }
+
+   switch ( node.op )  {
+
+      case local_var:
+         for (i=0; i<n; ++i)  out[i] = in[i];
+         break;
+
+      case op_add:
+         if ( node.is_int )  for (i=0; i<n; ++i)  out[i] = (int) a[i] + (int) b[i];
+         else                for (i=0; i<n; ++i)  out[i] = a[i] + b[i];
+         break;
+
+      case op_subtract:
+         if ( node.is_int )  for (i=0; i<n; ++i)  out[i] = (int) a[i] - (int) b[i];
+         else                for (i=0; i<n; ++i)  out[i] = a[i] - b[i];
+         break;
+
+      case op_multiply:
+         if ( node.is_int )  for (i=0; i<n; ++i)  out[i] = (int) a[i] * (int) b[i];
+         else                for (i=0; i<n; ++i)  out[i] = a[i] * b[i];
+         break;
+
+      case op_divide:
+         for (i=0; i<n; ++i)  {
+            if ( b[i] == 0.0 )  {
+               cerr << "\n\n  UserFunc_1Arg::eval_nodes() -> "
+                    << ( node.is_int ? "integer" : "floating-point" )
+                    << " division by zero!\n\n";
+               exit ( 1 );
+            }
+         }
+         if ( node.is_int )  for (i=0; i<n; ++i)  out[i] = (int) a[i] / (int) b[i];
+         else                for (i=0; i<n; ++i)  out[i] = a[i] / b[i];
+         break;
+
+      case op_power:
+         for (i=0; i<n; ++i)  out[i] = pow(a[i], b[i]);
+         break;
+
+      case op_square:
+         if ( node.is_int )  for (i=0; i<n; ++i)  out[i] = (int) a[i] * (int) a[i];
+         else                for (i=0; i<n; ++i)  out[i] = a[i] * a[i];
+         break;
+
+      case op_negate:
+         for (i=0; i<n; ++i)  out[i] = -a[i];
+         break;
+
+      case builtin_func:
+         {
+            const BuiltinInfo & info = binfo[node.builtin];
+
+            if ( info.id == builtin_nint )  {
+               if ( Nodes[node.arg[0]].is_int )  for (i=0; i<n; ++i)  out[i] = a[i];
+               else                              for (i=0; i<n; ++i)  out[i] = nint(a[i]);
+            }
+            else if ( info.id == builtin_sign )  {
+               for (i=0; i<n; ++i)  {
+                  if ( a[i] == 0.0 )  out[i] = 0;
+                  else                out[i] = ( (a[i] > 0.0) ? 1 : -1 );
+               }
+            }
+            else if ( info.n_args == 1 )  {
+               if ( node.is_int )  for (i=0; i<n; ++i)  out[i] = info.i1((int) a[i]);
+               else                for (i=0; i<n; ++i)  out[i] = info.d1(a[i]);
+            }
+            else  {
+               if ( node.is_int )  for (i=0; i<n; ++i)  out[i] = info.i2((int) a[i], (int) b[i]);
+               else                for (i=0; i<n; ++i)  out[i] = info.d2(a[i], b[i]);
+            }
+         }
+         break;
+
+      default:
+         cerr << "\n\n  UserFunc_1Arg::eval_nodes() -> "
+              << "bad node type ... \""
+              << celltype_to_string(node.op) << "\"\n\n";
+         exit ( 1 );
+
+   }   //  switch
+
+}   //  for j
+
 return;
 
 }
@@ -190,6 +582,28 @@ double UserFunc_1Arg::operator()(double x) const
 
 {
 
+if ( ! Nodes.empty() )  {
+
+   const int n_nodes = (int) Nodes.size();
+
+   if ( n_nodes <= max_scalar_nodes )  {
+
+      double work[max_scalar_nodes];
+
+      eval_nodes(&x, 1, work);
+
+      return work[n_nodes - 1];
+
+   }
+
+   std::vector<double> work(n_nodes);
+
+   eval_nodes(&x, 1, work.data());
+
+   return work[n_nodes - 1];
+
+}
+
 Number n;
 
 n.d = x;
@@ -204,6 +618,65 @@ return as_double(n);
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+void UserFunc_1Arg::apply(double * v, int n) const
+
+{
+
+int i, j, n_block;
+
+if ( ! is_set() )  return;
+
+if ( Nodes.empty() )  {
+
+   for (i=0; i<n; ++i)  {
+
+      if ( ! is_bad_data(v[i]) )  v[i] = (*this)(v[i]);
+
+   }
+
+   return;
+
+}
+
+   //
+   //  gather blocks of good values, evaluate, and scatter back
+   //
+
+const int n_nodes = (int) Nodes.size();
+std::vector<double> work(n_nodes*user_func_block_size);
+std::vector<double> in(user_func_block_size);
+std::vector<int> index(user_func_block_size);
+
+for (i=0; i<n; )  {
+
+   for (n_block=0; i<n && n_block<user_func_block_size; ++i)  {
+
+      if ( is_bad_data(v[i]) )  continue;
+
+      index[n_block] = i;
+      in[n_block]    = v[i];
+      ++n_block;
+
+   }
+
+   if ( n_block == 0 )  continue;
+
+   eval_nodes(in.data(), n_block, work.data());
+
+   const double * out = work.data() + (n_nodes - 1)*n_block;
+
+   for (j=0; j<n_block; ++j)  v[index[j]] = out[j];
+
+}
+
+return;
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -22,11 +22,40 @@
 ////////////////////////////////////////////////////////////////////////
 
 
+#include <vector>
+
 #include "is_number.h"
 #include "dictionary.h"
 #include "icode.h"
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  one node of a compiled user function expression tree
+   //
+   //    nodes are stored with their arguments first, so the
+   //    tree can be evaluated in a single pass over the nodes
+   //
+
+struct UserFuncNode {
+
+   CellType op;         //  floating_point for constants, local_var for the argument
+
+   bool is_int;         //  integer valued, as in the Calculator
+
+   bool is_const;       //  folded to a constant at compile time
+
+   double value;        //  constant value
+
+   int builtin;         //  index into binfo for builtin_func nodes
+
+   int arg[2];          //  argument node indices
+
+};
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -42,6 +71,23 @@ class UserFunc_1Arg {
       int          NArgs;
       IcodeVector  V;
 
+         //
+         //  compiled form of V, empty if V could not be compiled
+         //
+
+      std::vector<UserFuncNode> Nodes;
+
+      void compile();
+
+      bool compile_icv(const IcodeVector &, const std::vector<int> & locals,
+                       std::vector<int> & stack, int depth);
+
+      int add_const(const Number &);
+
+      int add_node(CellType op, int builtin, int n_args, const int * args);
+
+      void eval_nodes(const double * in, int n, double * work) const;
+
    public:
 
       UserFunc_1Arg();
@@ -75,6 +121,12 @@ class UserFunc_1Arg {
 
       double operator()(double) const;
 
+         //
+         //  apply in place to n values, leaving bad data unchanged
+         //
+
+      void apply(double *, int n) const;
+
 };
 
 
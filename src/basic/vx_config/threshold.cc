@@ -49,6 +49,170 @@ return ( t == thresh_le || t == thresh_ge || t == thresh_eq );
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  true if checking node could exit with an error, either for bad
+   //  climatology data or for an unset percentile threshold
+   //
+
+static bool check_may_exit(const ThreshNode * node)
+
+{
+
+vector<Simple_Node> simple;
+
+node->get_simple_nodes(simple);
+
+for (unsigned int i=0; i<simple.size(); ++i)  {
+
+   if ( simple[i].ptype() == perc_thresh_climo_dist )  return true;
+
+   if ( simple[i].ptype() != no_perc_thresh_type &&
+        is_bad_data(simple[i].value()) )  return true;
+
+}
+
+return false;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  evaluate node for the values whose current result in tf equals
+   //  "unresolved", which is the right child of an And_Node (true) or
+   //  Or_Node (false) for the array checks
+   //
+   //  when node could exit with an error, only the unresolved values
+   //  are checked to preserve the short-circuit logic of the single
+   //  value checks.  Otherwise, all values are checked and combined.
+   //
+
+static void check_unresolved(const ThreshNode * node,
+                             const double * x, const double * cmn, const double * csd,
+                             int n, bool * tf, bool unresolved)
+
+{
+
+int i, j;
+vector<int> index;
+
+if ( n <= 0 )  return;
+
+if ( ! check_may_exit(node) )  {
+
+   bool * tf_node = new bool [n];
+
+   node->check(x, cmn, csd, n, tf_node);
+
+   if ( unresolved )  for (i=0; i<n; ++i)  tf[i] = tf[i] && tf_node[i];
+   else               for (i=0; i<n; ++i)  tf[i] = tf[i] || tf_node[i];
+
+   if ( tf_node )  { delete [] tf_node;  tf_node = (bool *) 0; }
+
+   return;
+
+}
+
+index.reserve(n);
+
+for (i=0; i<n; ++i)  {
+
+   if ( tf[i] == unresolved )  index.push_back(i);
+
+}
+
+const int m = (int) index.size();
+
+if ( m == 0 )  return;
+
+if ( m == n )  { node->check(x, cmn, csd, n, tf);  return; }
+
+vector<double> x_sub(m), cmn_sub, csd_sub;
+bool * tf_sub = new bool [m];
+
+if ( cmn )  cmn_sub.resize(m);
+if ( csd )  csd_sub.resize(m);
+
+for (j=0; j<m; ++j)  {
+
+   x_sub[j] = x[index[j]];
+
+   if ( cmn )  cmn_sub[j] = cmn[index[j]];
+   if ( csd )  csd_sub[j] = csd[index[j]];
+
+}
+
+node->check(x_sub.data(), ( cmn ? cmn_sub.data() : nullptr ),
+            ( csd ? csd_sub.data() : nullptr ), m, tf_sub);
+
+for (j=0; j<m; ++j)  tf[index[j]] = tf_sub[j];
+
+if ( tf_sub )  { delete [] tf_sub;  tf_sub = (bool *) 0; }
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  single value comparison for Simple_Node, with the operation as a
+   //  template parameter so the array loops are free of branches.
+   //  This matches is_eq() and is_bad_data() in Simple_Node::check().
+   //
+
+template <int op>
+static inline bool simple_check(double x, double tval)
+
+{
+
+const bool eq = ( fabs(x - tval) < default_tol );
+const bool is_na = ( fabs(x - bad_data_double) < default_tol ) | ( x != x );
+
+switch ( op )  {
+
+   case thresh_le:   return ( (!is_na) & ( eq | (x <= tval)) );
+   case thresh_lt:   return ( (!is_na) & ((!eq) & (x <  tval)) );
+
+   case thresh_ge:   return ( (!is_na) & ( eq | (x >= tval)) );
+   case thresh_gt:   return ( (!is_na) & ((!eq) & (x >  tval)) );
+
+   case thresh_eq:   return (  eq );
+   case thresh_ne:   return ( !eq );
+
+   default:          return ( false );
+
+}   //  switch
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+template <int op>
+static void simple_check_array(const double * x, const double * tval_ptr,
+                               double tval, int n, bool * tf)
+
+{
+
+int i;
+
+if ( tval_ptr )  for (i=0; i<n; ++i)  tf[i] = simple_check<op>(x[i], tval_ptr[i]);
+else             for (i=0; i<n; ++i)  tf[i] = simple_check<op>(x[i], tval);
+
+return;
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 
 
@@ -149,6 +313,23 @@ return tf_right;
 ////////////////////////////////////////////////////////////////////////
 
 
+void Or_Node::check(const double * x, const double * cmn, const double * csd,
+                    int n, bool * tf) const
+
+{
+
+left_child->check(x, cmn, csd, n, tf);
+
+check_unresolved(right_child, x, cmn, csd, n, tf, false);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 ThreshNode * Or_Node::copy() const
 
 {
@@ -370,6 +551,23 @@ return ( tf_left && tf_right );
 ////////////////////////////////////////////////////////////////////////
 
 
+void And_Node::check(const double * x, const double * cmn, const double * csd,
+                     int n, bool * tf) const
+
+{
+
+left_child->check(x, cmn, csd, n, tf);
+
+check_unresolved(right_child, x, cmn, csd, n, tf, true);
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 ThreshNode * And_Node::copy() const
 
 {
@@ -604,6 +802,23 @@ return ( ! tf );
 ////////////////////////////////////////////////////////////////////////
 
 
+void Not_Node::check(const double * x, const double * cmn, const double * csd,
+                     int n, bool * tf) const
+
+{
+
+child->check(x, cmn, csd, n, tf);
+
+for (int i=0; i<n; ++i)  tf[i] = ! tf[i];
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 ThreshNode * Not_Node::copy() const
 
 {
@@ -870,6 +1085,102 @@ return tf;
 ////////////////////////////////////////////////////////////////////////
 
 
+void Simple_Node::check(const double * x, const double * cmn, const double * csd,
+                        int n, bool * tf) const
+
+{
+
+int i;
+
+if ( n <= 0 )  return;
+
+if ( op == thresh_na )  {
+
+   for (i=0; i<n; ++i)  tf[i] = true;
+
+   return;
+
+}
+
+const char * method_name = "Simple_Node::check(const double *, const double *, const double *, int, bool *) const -> ";
+double tval = T;
+vector<double> tval_cdp;
+
+   //
+   //  compute the climo distribution percentile thresholds
+   //
+
+if ( Ptype == perc_thresh_climo_dist ) {
+
+   tval_cdp.resize(n);
+
+   for (i=0; i<n; ++i)  {
+
+      const double mn = ( cmn ? cmn[i] : bad_data_double );
+      const double sd = ( csd ? csd[i] : bad_data_double );
+
+      if(is_bad_data(mn) || is_bad_data(sd)) {
+
+         mlog << Error << "\n" << method_name
+              << "climatological distribution percentile threshold \"" << s
+              << "\" requested with invalid mean (" << mn
+              << ") or standard deviation (" << sd << ").\n\n";
+
+         exit ( 1 );
+
+      }
+
+      tval_cdp[i] = normal_cdf_inv(PT/100.0, mn, sd);
+
+      if ( is_bad_data(tval_cdp[i]) )  break;
+
+   }
+
+}
+
+   //
+   //  check that percentile thresholds have been resolved
+   //
+
+if ( Ptype != no_perc_thresh_type &&
+     ( tval_cdp.empty() ? is_bad_data(tval) : i < n ) ) {
+
+   mlog << Error << "\n" << method_name
+        << "percentile threshold \"" << s
+        << "\" used before it was set.\n\n";
+
+   exit ( 1 );
+
+}
+
+const double * tval_ptr = ( tval_cdp.empty() ? nullptr : tval_cdp.data() );
+
+switch ( op )  {
+
+   case thresh_le:   simple_check_array<thresh_le>(x, tval_ptr, tval, n, tf);  break;
+   case thresh_lt:   simple_check_array<thresh_lt>(x, tval_ptr, tval, n, tf);  break;
+
+   case thresh_ge:   simple_check_array<thresh_ge>(x, tval_ptr, tval, n, tf);  break;
+   case thresh_gt:   simple_check_array<thresh_gt>(x, tval_ptr, tval, n, tf);  break;
+
+   case thresh_eq:   simple_check_array<thresh_eq>(x, tval_ptr, tval, n, tf);  break;
+   case thresh_ne:   simple_check_array<thresh_ne>(x, tval_ptr, tval, n, tf);  break;
+
+   default:
+      mlog << Error << "\n" << method_name
+           << "bad op ... " << op << "\n\n";
+      exit ( 1 );
+
+}   //  switch
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 ThreshNode * Simple_Node::copy() const
 
 {
@@ -1818,6 +2129,22 @@ return ( node ? node->check(x, cmn, csd) : true  );
 }
 
 
+////////////////////////////////////////////////////////////////////////
+
+
+void SingleThresh::check(const double * x, const double * cmn, const double * csd,
+                         int n, bool * tf) const
+
+{
+
+if ( node )  node->check(x, cmn, csd, n, tf);
+else         for (int i=0; i<n; ++i)  tf[i] = true;
+
+return;
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
 //
 // End code for class SingleThresh
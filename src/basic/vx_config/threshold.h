@@ -147,6 +147,13 @@ class ThreshNode {
       virtual bool check(double) const = 0;
       virtual bool check(double, double, double) const = 0;
 
+         //
+         //  check n values at once, storing the results in tf,
+         //  with null climo pointers treated as bad data
+         //
+
+      virtual void check(const double *, const double *, const double *, int, bool *) const = 0;
+
       virtual ThreshNode * copy() const = 0;
 
       virtual ThreshType type() const = 0;
@@ -188,6 +195,7 @@ class Or_Node : public ThreshNode {
 
       bool check(double) const;
       bool check(double, double, double) const;
+      void check(const double *, const double *, const double *, int, bool *) const;
 
       ThreshNode * copy() const;
 
@@ -239,6 +247,7 @@ class And_Node : public ThreshNode {
 
       bool check(double) const;
       bool check(double, double, double) const;
+      void check(const double *, const double *, const double *, int, bool *) const;
 
       ThreshType type() const;
 
@@ -290,6 +299,7 @@ class Not_Node : public ThreshNode {
 
       bool check(double) const;
       bool check(double, double, double) const;
+      void check(const double *, const double *, const double *, int, bool *) const;
 
       ThreshType type() const;
 
@@ -385,6 +395,7 @@ class Simple_Node : public ThreshNode {
 
       bool check(double) const;
       bool check(double, double, double) const;
+      void check(const double *, const double *, const double *, int, bool *) const;
 
       void multiply_by(const double);
 
@@ -455,6 +466,7 @@ class SingleThresh {
 
       bool           check(double) const;
       bool           check(double, double, double) const;
+      void           check(const double *, const double *, const double *, int, bool *) const;
 
 };
 
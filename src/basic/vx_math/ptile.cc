@@ -34,8 +34,6 @@ static int compare_float  (const void *, const void *);
 
 static int compare_rank(const void *, const void *);
 
-static void reset_rank(double *, int, int, double);
-
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -204,23 +202,23 @@ return ( 0 );
 // the raw data are encountered, replace the ranks for all of the tied data
 // with the mean of the ranks.
 //
+// If order is non-zero, it is filled with the indices of the data sorted
+// in increasing order, so that callers can reuse the sort.
+//
 ///////////////////////////////////////////////////////////////////////////////
 
 
-int do_rank(const double *array, double *rank, int n)
+int do_rank(const double *array, double *rank, int n, int *order)
 
 {
 
-if ( n <= 1 )  return(0);
+if ( n <= 0 )  return(0);
 
-int i, j, ties_current, ties_total, tie_rank_start = 0, tie_rank_end;
+int i, j, k, ties_total;
 double tie_rank_mean;
 RankInfo *rank_info = (RankInfo *) 0;
-double *ordered_array = (double *) 0;
-double prev_v, v;
 
 rank_info = new RankInfo [n];
-ordered_array = new double [n];
 
 // Each RankInfo structure contains a index value from 0 to n-1 and a pointer
 // to the data to be ranked
@@ -233,71 +231,31 @@ for(i=0; i<n; i++) {
 // values rather than the indices themselves
 qsort(rank_info, n, sizeof(RankInfo), compare_rank);
 
-// Compute and store the inverse permutation of the ranks computed
-for(i=0; i<n; i++) rank[rank_info[i].index] = i+1;
-
-// Use the rank just computed to create an ordered version of the data
-for(i=0; i<n; i++) { ordered_array[nint(rank[i] - 1)] = array[i]; }
-
-// Search through the ordered array looking for ties.  When ties are found
-// replace the corresponding ranks with the mean of the ranks.
-prev_v = -1.0e30;
-ties_current = ties_total = 0;
-
-for(i=0; i<n; i++) {
-
-   v = ordered_array[i];
+// Search through the sorted data looking for runs of ties.  The ranks
+// of tied data are replaced with the mean of their ranks.
+ties_total = 0;
 
-   // Check for a tie with the previous data value
-   if(is_eq(v, prev_v)) {
+for(i=0; i<n; i=j) {
 
-      // Check if this is the beginning of a run of ties
-      if(ties_current == 0) {
-        // Save the previous rank as the beginning of the run (i, not i+1)
-        tie_rank_start = i;
-      }
-
-      ties_current++;
-      ties_total++;
-   } // v != prev_v
-   else {
-
-      // Check if there was a run of ties that just ended
-      if(ties_current != 0) {
-         tie_rank_end = i;
+   // Find the end of the run of values tied with the previous one
+   for(j=i+1; j<n; j++) {
+      if(!is_eq(array[rank_info[j].index],
+                array[rank_info[j-1].index])) break;
+   }
 
-         // Compute the mean of the tied ranks
-         tie_rank_mean = (tie_rank_start + tie_rank_end)/2.0;
+   // Compute the mean of the ranks i+1 through j
+   tie_rank_mean = (j - i > 1 ? (i + 1 + j)/2.0 : (double) (i + 1));
 
-         // For each rank between tie_rank_start and tie_rank_end,
-         // replace it with tie_rank_mean
-         for(j=tie_rank_start; j<=tie_rank_end; j++) {
-            reset_rank(rank, n, j, tie_rank_mean);
-         }
+   for(k=i; k<j; k++) rank[rank_info[k].index] = tie_rank_mean;
 
-         // Reset ties_current to zero
-         ties_current = 0;
-      }
-   }
-   prev_v = v;
+   ties_total += j - i - 1;
 }
 
-// Check the end of the loop for any remaining ties
-if(ties_current != 0) {
-   tie_rank_end = n;
-
-   // Compute the mean of the tied ranks
-   tie_rank_mean = (tie_rank_start + tie_rank_end)/2.0;
-
-   // For each rank between tie_rank_start and tie_rank_end,
-   // replace it with tie_rank_mean
-   for(j=tie_rank_start; j<=tie_rank_end; j++) {
-      reset_rank(rank, n, j, tie_rank_mean);
-   }
+if(order) {
+   for(i=0; i<n; i++) order[i] = rank_info[i].index;
 }
 
-if(rank_info)     { delete [] rank_info;     rank_info = (RankInfo *) 0; }
-if(ordered_array) { delete [] ordered_array; ordered_array = (double *) 0; }
+if(rank_info) { delete [] rank_info; rank_info = (RankInfo *) 0; }
 
 return(ties_total);
 
@@ -323,19 +281,5 @@ return ( 0 );
 }
 
 
-///////////////////////////////////////////////////////////////////////////////
-
-static void reset_rank(double *rank, int n, int old_rank, double new_rank)
-
-{
-int i;
-
-for(i=0; i<n; i++) {
-   if(is_eq(rank[i], old_rank)) rank[i] = new_rank;
-}
-
-return;
-
-}
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -43,7 +43,7 @@ extern float percentile_f(const float * ordered_array, const int n, const double
 
 
 
-extern int do_rank(const double *array, double *rank, int n);
+extern int do_rank(const double *array, double *rank, int n, int *order = 0);
 
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -114,6 +114,8 @@ N_chars = N_ints = 0;
 
 Delimiter.assign(dataline_default_delim);
 
+set_delim_table();
+
 File = (LineDataFile *) 0;
 
 IsHeader = false;
@@ -131,8 +133,9 @@ void DataLine::clear()
 {
 
 Line.clear();
-Items.clear();
+ItemBuf.clear();
 Offset.clear();
+Length.clear();
 
 LineNumber = 0;
 
@@ -156,9 +159,10 @@ void DataLine::assign(const DataLine & a)
 clear();
 
 Line = a.Line;
-Items = a.Items;
+ItemBuf = a.ItemBuf;
 
 Offset = a.Offset;
+Length = a.Length;
 
 N_items = a.N_items;
 
@@ -197,7 +201,7 @@ for (j=0; j<N_items; ++j)  {
 
    snprintf(junk, sizeof(junk), "Item[%2d]       = \"", j);
 
-   out << prefix << junk << Items[j] << "\"\n";
+   out << prefix << junk << get_item(j) << "\"\n";
 
    if ( (j%5) == 4 )  out << prefix << '\n';
 
@@ -250,7 +254,7 @@ if ( (k < 0) || (k >= N_items) )  {
 
 }
 
-return Items[k].c_str();
+return ( ItemBuf.c_str() + Offset[k] );
 
 }
 
@@ -296,7 +300,7 @@ n = 0;
 
 for (j=0; j<N_items; ++j)  {
 
-   w = Items[j].size();
+   w = Length[j];
 
    if ( w > n )  n = w;
 
@@ -317,11 +321,6 @@ int DataLine::read_line(LineDataFile * ldf)
 
 clear();
 
-size_t pos, count;
-
-pos = 0;
-count = 0;
-
    //
    //  get a line from the file
    //
@@ -329,28 +328,10 @@ count = 0;
 if ( ! read_single_text_line(ldf) )  { clear();  return ( 0 ); }
 
    //
-   //  parse the line with strtok
+   //  split the line into items
    //
 
-size_t len, tpos = std::string::npos;
-
-if (0 == Line.find_first_not_of(Delimiter)) { // no leading delimiter
-    ++count;
-    Offset.push_back(pos);
-    Items.push_back(Line.substr(pos, Line.find_first_of(Delimiter, pos) - pos));
-}
-while ((tpos = Line.substr(pos).find_first_of(Delimiter)) != std::string::npos)  {
-    len = Line.substr(pos+tpos).find_first_not_of(Delimiter);
-    if (len == std::string::npos)  // delims at the end of the line, or delim-only line
-        break;
-    pos += tpos + len;
-    
-    ++count;
-    Offset.push_back(pos);
-    Items.push_back(Line.substr(pos, Line.find_first_of(Delimiter, pos) - pos));
-}
-
-N_items = count;
+tokenize();
 
 LineNumber = ldf->last_line_number() + 1;
 
@@ -437,7 +418,7 @@ for( i=0; i<n_wdth; i++ )  {
      }
    }
    
-   Items.push_back(Line.substr(start, pos-start));
+   Length.push_back(pos-start);
 
    //
    //  null terminate the entry
@@ -467,6 +448,12 @@ while ( f.get(c) )  {
 
 if ( !f )  { clear();  return ( 0 ); }
 
+   //
+   //  the entries in Line are already null-terminated
+   //
+
+ItemBuf = Line;
+
 N_items = count;
 
 LineNumber = ldf->last_line_number() + 1;
@@ -512,6 +499,90 @@ void DataLine::set_delimiter(const char *delimiter)
 
 Delimiter.assign(delimiter);
 
+set_delim_table();
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void DataLine::set_delim_table()
+
+{
+
+int j;
+
+for (j=0; j<256; ++j)  IsDelim[j] = false;
+
+for (j=0; j<(int) Delimiter.size(); ++j)  {
+
+   IsDelim[(unsigned char) Delimiter[j]] = true;
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  Split Line into items in a single pass.  The line is copied once
+   //  into ItemBuf and the delimiter following each item is replaced
+   //  with a null character, so each item is stored as an offset and
+   //  length rather than as a separate string.
+   //
+
+
+void DataLine::tokenize()
+
+{
+
+const int n = (int) Line.size();
+int j, start;
+char * buf = (char *) 0;
+
+ItemBuf.assign(Line.c_str(), n + 1);
+
+buf = &ItemBuf[0];
+
+Offset.clear();
+Length.clear();
+
+j = 0;
+
+while ( j < n )  {
+
+      //
+      //  skip delimiters
+      //
+
+   while ( (j < n) && IsDelim[(unsigned char) buf[j]] )  ++j;
+
+   if ( j >= n )  break;
+
+      //
+      //  find the end of this item and terminate it
+      //
+
+   start = j;
+
+   while ( (j < n) && !IsDelim[(unsigned char) buf[j]] )  ++j;
+
+   Offset.push_back(start);
+   Length.push_back(j - start);
+
+   buf[j++] = '\0';
+
+}
+
+N_items = (int) Offset.size();
+
+return;
+
 }
 
 
@@ -544,20 +615,11 @@ if ( !f )  return ( false );
 
 File = ldf;
 
-char c;
-
-
-while ( f.get(c) )  {
-
-   if ( !f )  return ( false );
-
-   if ( c == '\n' )  { break; }
-
-   Line += c;
-
-}
+   //
+   //  a final line with no trailing newline is not returned
+   //
 
-if ( !f )  return ( false );
+if ( !std::getline(f, Line) || f.eof() )  return ( false );
 
 
 return ( true );
@@ -907,9 +969,9 @@ if ( L.n_items() == 0 )  return ( out );
 
 int j;
 
-for (j = 0; j < L.Items.size(); j++) {
-    out << L.Items[j];
-    if (j < (L.Items.size() - 1))
+for (j = 0; j < L.n_items(); j++) {
+    out << L.get_item(j);
+    if (j < (L.n_items() - 1))
         out << ' ';
 }
 
@@ -932,9 +994,9 @@ Logger & operator<<(Logger & lgr, const DataLine & L)
 
 if ( L.n_items() == 0 )  return ( lgr );
 
-for (int j = 0; j < L.Items.size(); j++) {
-    lgr << L.Items[j];
-    if (j < (L.Items.size() - 1))
+for (int j = 0; j < L.n_items(); j++) {
+    lgr << L.get_item(j);
+    if (j < (L.n_items() - 1))
         lgr << ' ';
 }
 
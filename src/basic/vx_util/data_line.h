@@ -54,12 +54,22 @@ class DataLine {
    protected:
 
       std::string Line;
-      std::vector<std::string> Items;
+
+         //
+         //  copy of Line with each item null-terminated in place,
+         //  so that get_item() can return pointers into it
+         //
+
+      std::string ItemBuf;
       
       int N_chars;
 
       std::vector<int> Offset;
 
+      std::vector<int> Length;
+
+      bool IsDelim[256];
+
       int N_ints;
 
       int LineNumber;
@@ -75,6 +85,8 @@ class DataLine {
    
       void init_from_scratch();
       void assign(const DataLine &);
+      void set_delim_table();
+      void tokenize();
       int N_items;
 
    public:
@@ -493,9 +493,7 @@ void DataPlane::convert(const UserFunc_1Arg &convert_fx) {
 
    mlog << Debug(3) << "Applying conversion function.\n";
 
-   for(int i=0; i<Nxy; i++) {
-      if(!is_bad_data(buf()[i])) buf()[i] = convert_fx(buf()[i]);
-   }
+   convert_fx.apply(Data.data(), Nxy);
 
    return;
 }
@@ -10,11 +10,15 @@
 
 using namespace std;
 
+#include <algorithm>
 #include <cstdlib>
+#include <deque>
 #include <iostream>
 #include <math.h>
 #include <string.h>
 #include <unistd.h>
+#include <map>
+#include <vector>
 
 #ifdef _OPENMP
   #include "omp.h"
@@ -88,6 +92,337 @@ void rescale_probability(DataPlane &dp) {
 
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// The neighborhood computations process the grid template as a set of
+// column segments, each spanning a contiguous range of y offsets at
+// one x offset.  The statistics for each segment are computed with a
+// sliding window along the column, so the cost for each grid point
+// scales with the template width rather than its size.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct TemplateColumn {
+   int dx;
+   int lo;
+   int hi;
+};
+
+////////////////////////////////////////////////////////////////////////
+
+static void get_template_columns(GridTemplateFactory::GridTemplates shape,
+                                 int width, vector<TemplateColumn> &cols) {
+   map<int, vector<int> > col_map;
+   map<int, vector<int> >::iterator it;
+
+   cols.clear();
+
+   // Read the offsets from a template without the global wrap logic
+   GridTemplateFactory gtf;
+   GridTemplate* gt = gtf.buildGT(shape, width, false);
+
+   for(GridPoint *gp = gt->getFirst(0, 0, 1, 1);
+       gp != nullptr; gp = gt->getNext()) {
+      col_map[gp->x].push_back(gp->y);
+   }
+
+   delete gt;
+
+   // Split each column into contiguous segments
+   for(it = col_map.begin(); it != col_map.end(); it++) {
+
+      vector<int> &ys = it->second;
+      sort(ys.begin(), ys.end());
+
+      TemplateColumn c;
+      c.dx = it->first;
+      c.lo = c.hi = ys[0];
+
+      for(int i=1; i<(int) ys.size(); i++) {
+         if(ys[i] == c.hi + 1) {
+            c.hi = ys[i];
+         }
+         else {
+            cols.push_back(c);
+            c.lo = c.hi = ys[i];
+         }
+      }
+      cols.push_back(c);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Sliding minimum or maximum of each column window using a monotonic
+// deque, combined into the running neighborhood extremes.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void column_extreme(const vector<double> &col, int lo, int hi,
+                           bool is_max, vector<double> &ext_v,
+                           vector<int> &n_vld, deque<int> &q) {
+   int ny = (int) col.size();
+   int y, i_in, i_out, beg, end, n;
+
+   q.clear();
+
+   for(y=0, n=0, i_in=max(lo, 0), i_out=max(lo, 0); y<ny; y++) {
+
+      beg = max(y + lo, 0);
+      end = min(y + hi, ny - 1);
+
+      // Add points entering the window
+      for(; i_in<=end; i_in++) {
+         if(is_bad_data(col[i_in])) continue;
+         if(is_max) { while(!q.empty() && col[q.back()] <= col[i_in]) q.pop_back(); }
+         else       { while(!q.empty() && col[q.back()] >= col[i_in]) q.pop_back(); }
+         q.push_back(i_in);
+         n++;
+      }
+
+      // Remove points leaving the window
+      for(; i_out<beg; i_out++) {
+         if(!is_bad_data(col[i_out])) n--;
+      }
+      while(!q.empty() && q.front() < beg) q.pop_front();
+
+      n_vld[y] += n;
+
+      if(q.empty()) continue;
+
+      double v = col[q.front()];
+      if(is_bad_data(ext_v[y]) ||
+         (is_max ? v > ext_v[y] : v < ext_v[y])) ext_v[y] = v;
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Sliding sum and count of each column window.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void column_sum(const vector<double> &col, int lo, int hi,
+                       vector<long double> &sum, vector<int> &n_vld) {
+   int ny = (int) col.size();
+   int y, i, n;
+   long double s = 0.0;
+
+   for(n=0, i=lo; i<=hi; i++) {
+      if(i < 0 || i >= ny || is_bad_data(col[i])) continue;
+      s += col[i];
+      n++;
+   }
+
+   for(y=0; y<ny; y++) {
+
+      if(y > 0) {
+         i = y - 1 + lo;
+         if(i >= 0 && i < ny && !is_bad_data(col[i])) { s -= col[i]; n--; }
+         i = y + hi;
+         if(i >= 0 && i < ny && !is_bad_data(col[i])) { s += col[i]; n++; }
+      }
+
+      sum[y]   += s;
+      n_vld[y] += n;
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Binary indexed tree over the ranks of the valid data values, used to
+// maintain the sorted neighborhood values for the median.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void rank_add(vector<int> &tree, int r, int inc) {
+   for(r++; r<(int) tree.size(); r += (r & -r)) tree[r] += inc;
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static int rank_kth(const vector<int> &tree, int k) {
+   int pos = 0, step = 1;
+
+   while(2*step < (int) tree.size()) step *= 2;
+
+   for(; step>0; step/=2) {
+      if(pos + step < (int) tree.size() && tree[pos + step] <= k) {
+         pos += step;
+         k   -= tree[pos];
+      }
+   }
+
+   return(pos);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void rank_row(const vector<int> &rank, vector<int> &tree,
+                     const vector<TemplateColumn> &cols, int x, int y,
+                     int nx, int ny, bool wrap_lon, bool use_lo,
+                     int inc, int &n_vld) {
+   int xc, yc, r;
+
+   for(int i=0; i<(int) cols.size(); i++) {
+      xc = x + cols[i].dx;
+      yc = y + (use_lo ? cols[i].lo : cols[i].hi);
+      if(wrap_lon) xc = positive_modulo(xc, nx);
+      if(xc < 0 || xc >= nx || yc < 0 || yc >= ny) continue;
+      if((r = rank[xc*ny + yc]) < 0) continue;
+      rank_add(tree, r, inc);
+      n_vld += inc;
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void smooth_columns(const DataPlane &dp, DataPlane &smooth_dp,
+                           InterpMthd mthd,
+                           const vector<TemplateColumn> &cols,
+                           int n_pts, bool wrap_lon, double t) {
+   const int nx = dp.nx();
+   const int ny = dp.ny();
+   vector<int> rank;
+   vector<double> ranked;
+   int x;
+
+   // For the median, rank the valid data values
+   if(mthd == InterpMthd_Median) {
+      vector< pair<double,int> > vals;
+      for(x=0; x<nx; x++) {
+         for(int y=0; y<ny; y++) {
+            double v = dp.get(x, y);
+            if(!is_bad_data(v)) vals.push_back(pair<double,int>(v, x*ny + y));
+         }
+      }
+      sort(vals.begin(), vals.end());
+      rank.assign(nx*ny, -1);
+      ranked.resize(vals.size());
+      for(int i=0; i<(int) vals.size(); i++) {
+         rank[vals[i].second] = i;
+         ranked[i] = vals[i].first;
+      }
+   }
+
+#pragma omp parallel default(shared) private(x)
+   {
+      vector<double> col(ny), ext_v(ny);
+      vector<long double> sum(ny);
+      vector<int> n_vld(ny);
+      vector<int> tree;
+      deque<int> q;
+      int i, y, xc, n, k;
+      double v, delta;
+
+      if(mthd == InterpMthd_Median) tree.assign(ranked.size() + 1, 0);
+
+#pragma omp for schedule (static)
+      for(x=0; x<nx; x++) {
+
+         // Median: slide the sorted neighborhood values up the column
+         if(mthd == InterpMthd_Median) {
+
+            for(n=0, i=0; i<(int) cols.size(); i++) {
+               for(y=cols[i].lo; y<=cols[i].hi; y++) {
+                  xc = x + cols[i].dx;
+                  if(wrap_lon) xc = positive_modulo(xc, nx);
+                  if(xc < 0 || xc >= nx || y < 0 || y >= ny) continue;
+                  if(rank[xc*ny + y] < 0) continue;
+                  rank_add(tree, rank[xc*ny + y], 1);
+                  n++;
+               }
+            }
+
+            for(y=0; y<ny; y++) {
+
+               if(y > 0) {
+                  rank_row(rank, tree, cols, x, y - 1, nx, ny, wrap_lon, true,  -1, n);
+                  rank_row(rank, tree, cols, x, y,     nx, ny, wrap_lon, false,  1, n);
+               }
+
+               // Same as percentile() of the sorted values
+               if(n == 0 || (double) n / n_pts < t) {
+                  v = bad_data_double;
+               }
+               else {
+                  k     = nint(floor((n - 1)*0.5));
+                  delta = (n - 1)*0.5 - k;
+                  if(k == n - 1) v = ranked[rank_kth(tree, k)];
+                  else           v = (1 - delta)*ranked[rank_kth(tree, k)] +
+                                     delta*ranked[rank_kth(tree, k + 1)];
+               }
+
+               smooth_dp.set(v, x, y);
+            }
+
+            // Empty the tree for the next column
+            for(i=0; i<(int) cols.size(); i++) {
+               for(y=ny-1+cols[i].lo; y<=ny-1+cols[i].hi; y++) {
+                  xc = x + cols[i].dx;
+                  if(wrap_lon) xc = positive_modulo(xc, nx);
+                  if(xc < 0 || xc >= nx || y < 0 || y >= ny) continue;
+                  if(rank[xc*ny + y] < 0) continue;
+                  rank_add(tree, rank[xc*ny + y], -1);
+               }
+            }
+
+            continue;
+         }
+
+         // Minimum, maximum, and mean: combine the column windows
+         for(y=0; y<ny; y++) {
+            ext_v[y] = bad_data_double;
+            sum[y]   = 0.0;
+            n_vld[y] = 0;
+         }
+
+         for(i=0; i<(int) cols.size(); i++) {
+
+            xc = x + cols[i].dx;
+            if(wrap_lon) xc = positive_modulo(xc, nx);
+            if(xc < 0 || xc >= nx) continue;
+
+            for(y=0; y<ny; y++) col[y] = dp.get(xc, y);
+
+            if(mthd == InterpMthd_UW_Mean) {
+               column_sum(col, cols[i].lo, cols[i].hi, sum, n_vld);
+            }
+            else {
+               column_extreme(col, cols[i].lo, cols[i].hi,
+                              (mthd == InterpMthd_Max), ext_v, n_vld, q);
+            }
+         }
+
+         for(y=0; y<ny; y++) {
+            if((double) n_vld[y] / n_pts < t) {
+               v = bad_data_double;
+            }
+            else if(mthd == InterpMthd_UW_Mean) {
+               v = (double) (sum[y] / n_vld[y]);
+            }
+            else {
+               v = ext_v[y];
+            }
+            smooth_dp.set(v, x, y);
+         }
+
+      } // end for x
+
+   } // end omp parallel
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Smooth the DataPlane values using the interpolation method and
@@ -118,54 +453,68 @@ void smooth_field(const DataPlane &dp, DataPlane &smooth_dp,
         << "(" << gt->size() << ") " << gt->getClassName()
         << " interpolation method.\n";
 
+   // Use sliding windows over the template column segments
+   if(mthd == InterpMthd_Min    || mthd == InterpMthd_Max     ||
+      mthd == InterpMthd_Median || mthd == InterpMthd_UW_Mean ||
+      mthd == InterpMthd_MaxGauss) {
+      vector<TemplateColumn> cols;
+      get_template_columns(shape, width, cols);
+      smooth_columns(dp, smooth_dp,
+                     (mthd == InterpMthd_MaxGauss ? InterpMthd_Max : mthd),
+                     cols, gt->size(), wrap_lon,
+                     (mthd == InterpMthd_MaxGauss ? 0.0 : t));
+   }
+
    // Otherwise, apply smoothing to each grid point
-   for(x=0; x<dp.nx(); x++) {
-      for(y=0; y<dp.ny(); y++) {
+   else {
+      for(x=0; x<dp.nx(); x++) {
+         for(y=0; y<dp.ny(); y++) {
 
-         // Compute the smoothed value based on the interpolation method
-         switch(mthd) {
+            // Compute the smoothed value based on the interpolation method
+            switch(mthd) {
 
-            case(InterpMthd_Min):      // Minimum
-               v = interp_min(dp, *gt, x, y, t);
-               break;
+               case(InterpMthd_Min):      // Minimum
+                  v = interp_min(dp, *gt, x, y, t);
+                  break;
 
-            case(InterpMthd_Max):      // Maximum
-               v = interp_max(dp, *gt, x, y, t);
-               break;
+               case(InterpMthd_Max):      // Maximum
+                  v = interp_max(dp, *gt, x, y, t);
+                  break;
 
-            case(InterpMthd_Median):   // Median
-               v = interp_median(dp, *gt, x, y, t);
-               break;
+               case(InterpMthd_Median):   // Median
+                  v = interp_median(dp, *gt, x, y, t);
+                  break;
 
-            case(InterpMthd_UW_Mean):  // Unweighted Mean
-               v = interp_uw_mean(dp, *gt, x, y, t);
-               break;
+               case(InterpMthd_UW_Mean):  // Unweighted Mean
+                  v = interp_uw_mean(dp, *gt, x, y, t);
+                  break;
 
-            case(InterpMthd_Gaussian): // For Gaussian, pass the data through
-               v = dp.get(x, y);
-               break;
+               case(InterpMthd_Gaussian): // For Gaussian, pass the data through
+                  v = dp.get(x, y);
+                  break;
 
-            case(InterpMthd_MaxGauss): // For Max Gaussian, compute the max
-               v = interp_max(dp, *gt, x, y, 0);
-               break;
+               case(InterpMthd_MaxGauss): // For Max Gaussian, compute the max
+                  v = interp_max(dp, *gt, x, y, 0);
+                  break;
 
-            // Distance-weighted mean, area-weighted mean, least-squares
-            // fit, and bilinear are omitted here since they are not
-            // options for gridded data.
+               // Distance-weighted mean, area-weighted mean, least-squares
+               // fit, and bilinear are omitted here since they are not
+               // options for gridded data.
 
-            default:
-               mlog << Error << "\nsmooth_field() -> "
-                    << "unsupported interpolation method encountered: "
-                    << interpmthd_to_string(mthd) << "(" << mthd
-                    << ")\n\n";
-               exit(1);
-         }
+               default:
+                  mlog << Error << "\nsmooth_field() -> "
+                       << "unsupported interpolation method encountered: "
+                       << interpmthd_to_string(mthd) << "(" << mthd
+                       << ")\n\n";
+                  exit(1);
+            }
 
-         // Store the smoothed value
-         smooth_dp.set(v, x, y);
+            // Store the smoothed value
+            smooth_dp.set(v, x, y);
 
-      } // end for y
-   } // end for x
+         } // end for y
+      } // end for x
+   } // end else
 
    // Apply the Gaussian smoother 
    if(mthd == InterpMthd_Gaussian ||
@@ -208,20 +557,57 @@ void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
         int width, GridTemplateFactory::GridTemplates shape,
         bool wrap_lon, SingleThresh t,
         const DataPlane *cmn, const DataPlane *csd, double vld_t) {
-   GridPoint *gp = nullptr;
+   CoverageCounts cc;
+
+   cc.set(dp, t, cmn, csd);
+   cc.fractional_coverage(frac_dp, width, shape, wrap_lon, vld_t);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Code for class CoverageCounts
+//
+////////////////////////////////////////////////////////////////////////
+
+CoverageCounts::CoverageCounts() {
+   init_from_scratch();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+CoverageCounts::~CoverageCounts() {
+   clear();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void CoverageCounts::init_from_scratch() {
+   clear();
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void CoverageCounts::clear() {
+   Nx = Ny = 0;
+   InitTime = ValidTime = (unixtime) 0;
+   LeadTime = AccumTime = 0;
+   VldSum.clear();
+   ThrSum.clear();
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void CoverageCounts::set(const DataPlane &dp, const SingleThresh &t,
+                         const DataPlane *cmn, const DataPlane *csd) {
    int x, y;
-   int n_vld = 0;
-   int n_thr = 0;
    double v;
-   double bad = bad_data_double;
    bool use_climo = false;
 
-   // Check that width is set to 1 or greater
-   if(width < 1) {
-      mlog << Error << "\nfractional_coverage() -> "
-           << "grid must have at least one point in it. \n\n";
-      exit(1);
-   }
+   clear();
 
    // Check climatology data, if needed
    if(cmn && csd) {
@@ -233,7 +619,7 @@ void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
 
       // Check dimensions
       if(cmn->nx() != dp.nx() || cmn->ny() != dp.ny()) {
-         mlog << Error << "\nfractional_coverage() -> "
+         mlog << Error << "\nCoverageCounts::set() -> "
            << "climatology mean dimension ("
            << cmn->nx() << ", " << cmn->ny()
            << ") does not match the data dimenion ("
@@ -241,7 +627,7 @@ void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
          exit(1);
       }
       if(csd->nx() != dp.nx() || csd->ny() != dp.ny()) {
-         mlog << Error << "\nfractional_coverage() -> "
+         mlog << Error << "\nCoverageCounts::set() -> "
            << "climatology standard deviation dimension ("
            << csd->nx() << ", " << csd->ny()
            << ") does not match the data dimenion ("
@@ -250,95 +636,207 @@ void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
       }
    }
 
-#pragma omp parallel default(none)                      \
-   shared(mlog, dp, frac_dp, shape, width, wrap_lon, t) \
-   shared(use_climo, cmn, csd, vld_t, bad)              \
-   private(x, y, n_vld, n_thr, gp, v)
+   mlog << Debug(3)
+        << "Applying the " << t.get_str()
+        << " threshold for fractional coverage.\n";
+
+   Nx        = dp.nx();
+   Ny        = dp.ny();
+   InitTime  = dp.init();
+   ValidTime = dp.valid();
+   LeadTime  = dp.lead();
+   AccumTime = dp.accum();
+
+   const int nx1 = Nx + 1;
+
+   VldSum.assign((Nx + 1)*(Ny + 1), 0);
+   ThrSum.assign((Nx + 1)*(Ny + 1), 0);
+
+   // Apply the threshold to the valid data in each row at once and
+   // sum along the row
+#pragma omp parallel for default(shared) private(x, y, v) schedule (static)
+   for(y=0; y<Ny; y++) {
+      int i, n_vld;
+      int n = (y + 1)*nx1;
+      vector<int>    vld_x(Nx);
+      vector<double> vld_v(Nx), vld_mn, vld_sd;
+      bool *tf = new bool [Nx];
+
+      if(use_climo) {
+         vld_mn.resize(Nx);
+         vld_sd.resize(Nx);
+      }
+
+      for(x=0, n_vld=0; x<Nx; x++) {
+         if(is_bad_data(v = dp.get(x, y))) continue;
+         vld_x[n_vld] = x;
+         vld_v[n_vld] = v;
+         if(use_climo) {
+            vld_mn[n_vld] = cmn->get(x, y);
+            vld_sd[n_vld] = csd->get(x, y);
+         }
+         n_vld++;
+      }
+
+      t.check(vld_v.data(),
+              (use_climo ? vld_mn.data() : nullptr),
+              (use_climo ? vld_sd.data() : nullptr),
+              n_vld, tf);
+
+      for(i=0; i<n_vld; i++) {
+         VldSum[n+vld_x[i]+1] = 1;
+         if(tf[i]) ThrSum[n+vld_x[i]+1] = 1;
+      }
+      for(x=0; x<Nx; x++, n++) {
+         VldSum[n+1] += VldSum[n];
+         ThrSum[n+1] += ThrSum[n];
+      }
+
+      if(tf) { delete [] tf; tf = (bool *) 0; }
+   }
+
+   // Accumulate the row sums up each column
+#pragma omp parallel for default(shared) private(x, y) schedule (static)
+   for(x=1; x<=Nx; x++) {
+      for(y=1; y<=Ny; y++) {
+         VldSum[y*nx1 + x] += VldSum[(y - 1)*nx1 + x];
+         ThrSum[y*nx1 + x] += ThrSum[(y - 1)*nx1 + x];
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Sum of the points in columns [x0, x1] and rows [y0, y1], all of
+// which must be on the grid.
+//
+////////////////////////////////////////////////////////////////////////
+
+static inline int rect_sum(const vector<int> &sum, int nx1,
+                           int y0, int y1, int x0, int x1) {
+   return(sum[(y1 + 1)*nx1 + x1 + 1] - sum[y0*nx1 + x1 + 1] -
+          sum[(y1 + 1)*nx1 + x0]     + sum[y0*nx1 + x0]);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Count the points in the rectangle [x0, x1] x [y0, y1] in which the
+// x range is either clipped to the grid or wrapped around it,
+// consistent with the GridTemplate logic.
+//
+////////////////////////////////////////////////////////////////////////
+
+int CoverageCounts::rect_count(const vector<int> &sum, int x0, int x1,
+                               int y0, int y1, bool wrap_lon) const {
+   const int nx1 = Nx + 1;
+   int n = 0;
+
+   y0 = max(y0, 0);
+   y1 = min(y1, Ny - 1);
+
+   if(y0 > y1 || x0 > x1) return(0);
+
+   if(!wrap_lon) {
+      x0 = max(x0, 0);
+      x1 = min(x1, Nx - 1);
+      if(x0 <= x1) n = rect_sum(sum, nx1, y0, y1, x0, x1);
+   }
+   else {
+      int len = x1 - x0 + 1;
+      int beg = positive_modulo(x0, Nx);
+      int end = beg + len%Nx - 1;
+
+      // Templates wider than the grid count columns more than once
+      if(len/Nx > 0) n += (len/Nx)*rect_sum(sum, nx1, y0, y1, 0, Nx - 1);
+
+      if(len%Nx > 0) {
+         if(end < Nx) n += rect_sum(sum, nx1, y0, y1, beg, end);
+         else         n += rect_sum(sum, nx1, y0, y1, beg, Nx - 1) +
+                           rect_sum(sum, nx1, y0, y1, 0, end - Nx);
+      }
+   }
+
+   return(n);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void CoverageCounts::fractional_coverage(DataPlane &frac_dp, int width,
+                        GridTemplateFactory::GridTemplates shape,
+                        bool wrap_lon, double vld_t) const {
+   vector<TemplateColumn> cols;
+   int x, y, i, n_pts, n_vld, n_thr;
+   bool is_rect;
+
+   // Check that width is set to 1 or greater
+   if(width < 1) {
+      mlog << Error << "\nCoverageCounts::fractional_coverage() -> "
+           << "grid must have at least one point in it. \n\n";
+      exit(1);
+   }
+
+   // Get the template column segments
+   get_template_columns(shape, width, cols);
+
+   // Check for a rectangular template
+   for(i=0, n_pts=0, is_rect=true; i<(int) cols.size(); i++) {
+      n_pts += cols[i].hi - cols[i].lo + 1;
+      if(i > 0 && (cols[i].dx != cols[i-1].dx + 1 ||
+                   cols[i].lo != cols[0].lo ||
+                   cols[i].hi != cols[0].hi)) is_rect = false;
+   }
+
    {
+      GridTemplateFactory gtf;
+      GridTemplate* gt = gtf.buildGT(shape, width, wrap_lon);
 
-     // Build the grid template
-     GridTemplateFactory gtf;
-     GridTemplate* gt = gtf.buildGT(shape, width, wrap_lon);
+      mlog << Debug(3)
+           << "Computing fractional coverage field using the "
+           << interpmthd_to_string(InterpMthd_Nbrhd) << "(" << gt->size()
+           << ") " << gt->getClassName() << " interpolation method.\n";
 
-#pragma omp single
-     {
-       mlog << Debug(3)
-            << "Computing fractional coverage field using the "
-            << t.get_str() << " threshold and the "
-            << interpmthd_to_string(InterpMthd_Nbrhd) << "(" << gt->size()
-            << ") " << gt->getClassName() << " interpolation method.\n";
+      delete gt;
+   }
 
-       // Initialize the fractional coverage field
-       frac_dp = dp;
-       frac_dp.set_constant(bad_data_double);
-     }
+   // Initialize the fractional coverage field
+   frac_dp.set_size(Nx, Ny);
+   frac_dp.set_constant(bad_data_double);
+   frac_dp.set_init(InitTime);
+   frac_dp.set_valid(ValidTime);
+   frac_dp.set_lead(LeadTime);
+   frac_dp.set_accum(AccumTime);
+
+   // Compute the fractional coverage from the counts
+#pragma omp parallel for default(shared) private(x, y, i, n_vld, n_thr) schedule (static)
+   for(y=0; y<Ny; y++) {
+      for(x=0; x<Nx; x++) {
+
+         // Rectangles need a single lookup
+         if(is_rect) {
+            int x0 = x + cols[0].dx;
+            int x1 = x + cols[cols.size()-1].dx;
+            n_vld = rect_count(VldSum, x0, x1, y + cols[0].lo, y + cols[0].hi, wrap_lon);
+            n_thr = rect_count(ThrSum, x0, x1, y + cols[0].lo, y + cols[0].hi, wrap_lon);
+         }
+         // Otherwise, sum the column segments
+         else {
+            for(i=0, n_vld=n_thr=0; i<(int) cols.size(); i++) {
+               n_vld += rect_count(VldSum, x + cols[i].dx, x + cols[i].dx,
+                                   y + cols[i].lo, y + cols[i].hi, wrap_lon);
+               n_thr += rect_count(ThrSum, x + cols[i].dx, x + cols[i].dx,
+                                   y + cols[i].lo, y + cols[i].hi, wrap_lon);
+            }
+         }
 
-     // Compute the fractional coverage meeting the threshold criteria
-#pragma omp for schedule (static)
-     for(x=0; x<dp.nx(); x++) {
-        for(y=0; y<dp.ny(); y++) {
-
-           // For a new column, reset the grid template and counts.
-           if(y == 0) {
-
-              // Initialize counts
-              n_vld = n_thr = 0;
-
-              // Sum all the points
-              for(gp  = gt->getFirstInGrid(x, y, dp.nx(), dp.ny());
-                  gp != nullptr;
-                  gp  = gt->getNextInGrid()) {
-                 if(is_bad_data(v = dp.get(gp->x, gp->y))) continue;
-                 n_vld++;
-                 if(t.check(v,
-                    (use_climo ? cmn->get(gp->x, gp->y) : bad),
-                    (use_climo ? csd->get(gp->x, gp->y) : bad))) n_thr++;
-              }
-           }
-           // Subtract off the bottom edge, shift up, and add the top.
-           else {
-
-              // Subtract points from the the bottom edge
-              for(gp  = gt->getFirstInBotEdge();
-                  gp != nullptr;
-                  gp  = gt->getNextInBotEdge()) {
-                 if(is_bad_data(v = dp.get(gp->x, gp->y))) continue;
-                 n_vld--;
-                 if(t.check(v,
-                    (use_climo ? cmn->get(gp->x, gp->y) : bad),
-                    (use_climo ? csd->get(gp->x, gp->y) : bad))) n_thr--;
-              }
-
-              // Increment Y
-              gt->incBaseY(1);
-
-              // Add points from the the top edge
-              for(gp  = gt->getFirstInTopEdge();
-                  gp != nullptr;
-                  gp  = gt->getNextInTopEdge()) {
-                 if(is_bad_data(v = dp.get(gp->x, gp->y))) continue;
-                 n_vld++;
-                 if(t.check(v,
-                    (use_climo ? cmn->get(gp->x, gp->y) : bad),
-                    (use_climo ? csd->get(gp->x, gp->y) : bad))) n_thr++;
-              }
-           }
-
-           // Check for enough valid data and compute fractional coverage
-           if((double)(n_vld)/gt->size() >= vld_t && n_vld != 0) {
-              frac_dp.set((double) n_thr/n_vld, x, y);
-           }
-
-        } // end for y
-
-        // Increment X
-        if(x < (dp.nx() - 1)) gt->incBaseX(1);
-
-     } // end for x
-
-     delete gt;
-
-   } // End of omp parallel
+         // Check for enough valid data and compute fractional coverage
+         if((double)(n_vld)/n_pts >= vld_t && n_vld != 0) {
+            frac_dp.set((double) n_thr/n_vld, x, y);
+         }
+
+      } // end for x
+   } // end for y
 
    return;
 }
@@ -25,6 +25,8 @@
 
 ////////////////////////////////////////////////////////////////////////
 
+#include <vector>
+
 #include "data_plane.h"
 #include "interp_mthd.h"
 #include "num_array.h"
@@ -55,6 +57,60 @@ extern void fractional_coverage(const DataPlane &dp, DataPlane &frac_dp,
                bool wrap_lon, SingleThresh t,
                const DataPlane *cmn, const DataPlane *csd, double vld_t);
 
+////////////////////////////////////////////////////////////////////////
+//
+// Integral images of the valid and threshold-exceeding points of a
+// field.  The threshold is applied once in set() and the fractional
+// coverage can then be computed for any neighborhood width and shape.
+//
+////////////////////////////////////////////////////////////////////////
+
+class CoverageCounts {
+
+   private:
+
+      void init_from_scratch();
+
+      int Nx;
+      int Ny;
+
+      unixtime InitTime;
+      unixtime ValidTime;
+      int      LeadTime;
+      int      AccumTime;
+
+         // (Nx+1)*(Ny+1) cumulative counts of points in [0,x)*[0,y)
+
+      std::vector<int> VldSum;
+      std::vector<int> ThrSum;
+
+      int rect_count(const std::vector<int> &, int x0, int x1,
+                     int y0, int y1, bool wrap_lon) const;
+
+   public:
+
+      CoverageCounts();
+     ~CoverageCounts();
+
+      void clear();
+
+      bool is_empty() const;
+
+      void set(const DataPlane &dp, const SingleThresh &t,
+               const DataPlane *cmn, const DataPlane *csd);
+
+      void fractional_coverage(DataPlane &frac_dp, int width,
+                               GridTemplateFactory::GridTemplates shape,
+                               bool wrap_lon, double vld_t) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline bool CoverageCounts::is_empty() const { return(VldSum.empty()); }
+
+////////////////////////////////////////////////////////////////////////
+
 extern void apply_mask(const DataPlane &, const MaskPlane &, NumArray &);
 extern void apply_mask(DataPlane &, const MaskPlane &);
 extern void apply_mask(MaskPlane &, const MaskPlane &);
@@ -0,0 +1,70 @@
+
+
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <cstring>
+
+#include "hash_util.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const unsigned long long fnv1a_offset_basis = 14695981039346656037ULL;
+static const unsigned long long fnv1a_prime        = 1099511628211ULL;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+unsigned long long fnv1a_hash(const void * buf, size_t n_bytes)
+
+{
+
+const unsigned char * c = (const unsigned char *) buf;
+unsigned long long h = fnv1a_offset_basis;
+size_t j;
+
+for (j=0; j<n_bytes; ++j)  {
+
+   h ^= c[j];
+   h *= fnv1a_prime;
+
+}
+
+return ( h );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+unsigned long long fnv1a_hash(const char * s)
+
+{
+
+if ( !s )  return ( fnv1a_offset_basis );
+
+return ( fnv1a_hash(s, strlen(s)) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -0,0 +1,47 @@
+
+
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __HASH_UTIL_H__
+#define  __HASH_UTIL_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include <cstddef>
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  64-bit FNV-1a hash, used to name the files in on-disk caches
+   //
+
+extern unsigned long long fnv1a_hash(const void * buf, size_t n_bytes);
+
+extern unsigned long long fnv1a_hash(const char * s);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __HASH_UTIL_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
+
+
@@ -128,6 +128,8 @@ V.clear();
 
 LonShift = 0.0;
 
+UMin = UMax = VMin = VMax = 0.0;
+
 Npoints = 0;
 
 return;
@@ -159,6 +161,11 @@ V = m.V;
 
 LonShift = m.LonShift;
 
+UMin = m.UMin;
+UMax = m.UMax;
+VMin = m.VMin;
+VMax = m.VMax;
+
 return;
 
 }
@@ -405,6 +412,19 @@ if ( fabs(Lon.max() - Lon.min()) > 180.0 ) {
       Lon.set(j, b);
         U.set(j, b);
    }
+}
+
+   //
+   //  bounding box, for quickly rejecting points in latlon_is_inside()
+   //
+
+for ( j=0; j<Npoints; j++ ) {
+
+   if ( j == 0 || U[j] < UMin )  UMin = U[j];
+   if ( j == 0 || U[j] > UMax )  UMax = U[j];
+   if ( j == 0 || V[j] < VMin )  VMin = V[j];
+   if ( j == 0 || V[j] > VMax )  VMax = V[j];
+
 }
 
    //
@@ -434,6 +454,13 @@ double adj_lon;
 adj_lon  = cur_lon + LonShift;
 adj_lon -= 360.0*floor((adj_lon + 180.0)/360.0);
 
+   //
+   //  points outside the bounding box have a winding number of zero
+   //
+
+if ( adj_lon < UMin || adj_lon > UMax ||
+     cur_lat < VMin || cur_lat > VMax )  return ( false );
+
 status = is_inside(U, V, adj_lon, cur_lat);
 
 return ( status != 0 );
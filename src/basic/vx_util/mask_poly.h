@@ -50,6 +50,9 @@ class MaskPoly {
 
       double LonShift;
 
+      double UMin, UMax;   //  bounding box of the U and V points
+      double VMin, VMax;
+
       int Npoints;
 
    public:
@@ -629,38 +629,28 @@ void NumArray::reorder(const NumArray &i_na) {
 ////////////////////////////////////////////////////////////////////////
 //
 // Compute the rank of the values in the array and return the number
-// of valid data values that were ranked.
+// of valid data values that were ranked.  If order is non-zero, it is
+// filled with the array indices of the valid data values sorted in
+// increasing order.
 //
 ////////////////////////////////////////////////////////////////////////
 
 
-int NumArray::rank_array(int &ties)
+int NumArray::rank_array(int &ties, std::vector<int> *order)
 
 {
 
    int n_vld, i;
 
-   double *data      = (double *) 0;
-   int    *data_loc  = (int *) 0;
-   double *data_rank = (double *) 0;
-
    //
    // Arrays to store the raw data values to be ranked, their locations,
    // and their computed ranks.  The ranks are stored as doubles since
    // they can be set to 0.5 in the case of ties.
    //
-   data      = new double [n_elements()];
-   data_loc  = new int    [n_elements()];
-   data_rank = new double [n_elements()];
-   
-   if ( !data || !data_loc || !data_rank )  {
-
-      mlog << Error << "\nint NumArray::rank_array() -> "
-           << "memory allocation error\n\n";
-
-      exit ( 1 );
-
-   }
+   vector<double> data(n_elements());
+   vector<int>    data_loc(n_elements());
+   vector<double> data_rank(n_elements());
+   vector<int>    data_order(n_elements());
 
    //
    // Search the data array for valid data and keep track of its location
@@ -678,7 +668,7 @@ int NumArray::rank_array(int &ties)
    // Compute the rank of the data and store the ranks in the data_rank array
    // Keep track of the number of ties in the ranks.
    //
-   ties = do_rank(data, data_rank, n_vld);
+   ties = do_rank(data.data(), data_rank.data(), n_vld, data_order.data());
 
    //
    // Store the data_rank values
@@ -686,11 +676,12 @@ int NumArray::rank_array(int &ties)
    for(i=0; i<n_vld; i++) e[data_loc[i]] = data_rank[i];
 
    //
-   // Deallocate memory
+   // Store the sorted order
    //
-   if(data)      { delete [] data;      data      = (double *) 0; }
-   if(data_loc)  { delete [] data_loc;  data_loc  = (int *) 0;    }
-   if(data_rank) { delete [] data_rank; data_rank = (double *) 0; }
+   if(order) {
+      order->resize(n_vld);
+      for(i=0; i<n_vld; i++) (*order)[i] = data_loc[data_order[i]];
+   }
 
    Sorted = false;
 
@@ -1291,23 +1282,31 @@ double NumArray::mean_abs_diff() const
 
 {
 
-   int i, j, count;
+   int i, n_vld;
    double sum, mad;
 
-   int n = n_elements();
-   
-   for(i=0, count=0, sum=0.0; i<n; i++) {
-      for(j=i+1; j<n; j++) {
-      
-         if( is_bad_data(e[i]) || is_bad_data(e[j]) ) continue;
-         sum += abs(e[i]-e[j]);
-         count++;
-      }
+   //
+   // Sort the valid values, unless already sorted
+   //
+   vector<double> v;
+   v.reserve(n_elements());
+   for(i=0; i<n_elements(); i++) {
+      if(!is_bad_data(e[i])) v.push_back(e[i]);
    }
-   
-   if(count == 0) mad = bad_data_double;
-   else           mad = sum / count;
-   
+   if(!Sorted) sort(v.begin(), v.end());
+
+   //
+   // For sorted values, the sum of |v[j] - v[i]| over all pairs
+   // i < j is the sum of v[i]*(2*i - n + 1)
+   //
+   n_vld = (int) v.size();
+   for(i=0, sum=0.0; i<n_vld; i++) {
+      sum += v[i] * (2*i - n_vld + 1);
+   }
+
+   if(n_vld < 2) mad = bad_data_double;
+   else          mad = sum / ((double) n_vld * (n_vld - 1) / 2.0);
+
    return(mad);
 
 }
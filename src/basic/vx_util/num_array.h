@@ -19,6 +19,7 @@
 
 
 #include <iostream>
+#include <vector>
 
 #include "concat_string.h"
 #include "is_bad_data.h"
@@ -59,6 +60,8 @@ class NumArray {
 
       const double * vals() const;
       double * buf();
+
+      bool is_sorted() const;
       
       int has(int, bool forward=true)    const;
       int has(double, bool forward=true) const;
@@ -85,7 +88,7 @@ class NumArray {
 
       void   sort_array();
       void   reorder(const NumArray &);
-      int    rank_array(int &);
+      int    rank_array(int &, std::vector<int> *order = 0);
       double percentile_array(double);
       double compute_percentile(double, bool) const;
       double iqr();
@@ -131,6 +134,7 @@ inline int            NumArray::n_elements()         const { return ( e.size() )
 inline int            NumArray::n         ()         const { return ( e.size() ); }
 inline const double * NumArray::vals()               const { return ( e.data() ); }
 inline       double * NumArray::buf()                      { return ( e.data() ); }
+inline bool           NumArray::is_sorted()          const { return ( Sorted ); }
 inline void           NumArray::inc(int i, int v)          { e[i] += v; return;   }
 inline void           NumArray::inc(int i, double v)       { e[i] += v; return;   }
 
@@ -445,6 +445,22 @@ bool ThreshArray::check_dbl(double v, double mn, double sd) const {
    return(true);
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Check n values against each threshold in the array. The result for
+// threshold i and value j is stored in tf[i*n + j]. Null climatology
+// pointers are treated as bad data.
+//
+////////////////////////////////////////////////////////////////////////
+
+void ThreshArray::check_array(const double *v, const double *mn,
+                              const double *sd, int n, bool *tf) const {
+
+   for(int i=0; i<Nelements; i++) t[i].check(v, mn, sd, n, tf + i*n);
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 bool ThreshArray::need_perc() {
@@ -87,6 +87,9 @@ class ThreshArray {
 
       bool check_dbl(double) const;
       bool check_dbl(double, double, double) const;
+
+      void check_array(const double *, const double *, const double *,
+                       int, bool *) const;
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -36,6 +36,7 @@
 #include "filename_suffix.h"
 #include "fix_float.h"
 #include "get_filenames.h"
+#include "hash_util.h"
 #include "grib_constants.h"
 #include "int_array.h"
 #include "interp_mthd.h"
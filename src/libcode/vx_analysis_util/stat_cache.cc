@@ -0,0 +1,598 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "stat_cache.h"
+#include "temp_file.h"
+
+#include "vx_log.h"
+
+////////////////////////////////////////////////////////////////////////
+
+static const char stat_cache_magic[]   = "MET_STAT_CACHE";
+static const int  stat_cache_version   = 1;
+static const int  stat_cache_byte_order = 0x01020304;
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+static void write_column(ofstream &out, const vector<T> &v) {
+   if(!v.empty()) {
+      out.write((const char *) v.data(), v.size()*sizeof(T));
+   }
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+static bool read_column(ifstream &in, vector<T> &v, int n) {
+   v.resize(n);
+   if(n > 0) in.read((char *) v.data(), n*sizeof(T));
+   return((bool) in);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+static void write_value(ofstream &out, const T &v) {
+   out.write((const char *) &v, sizeof(T));
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+static bool read_value(ifstream &in, T &v) {
+   in.read((char *) &v, sizeof(T));
+   return((bool) in);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+//  Code for class STATCache
+//
+////////////////////////////////////////////////////////////////////////
+
+STATCache::STATCache() {
+
+   init_from_scratch();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+STATCache::~STATCache() {
+
+   clear();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void STATCache::init_from_scratch() {
+
+   clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void STATCache::clear() {
+   int i;
+
+   StatFile.clear();
+   StatSize  = 0;
+   StatMtime = 0;
+
+   NRows = NData = 0;
+
+   Beg.clear();
+   End.clear();
+   IsHeader.clear();
+
+   for(i=0; i<n_stat_cache_columns; i++) {
+      Dict[i].clear();
+      Code[i].clear();
+      DictIndex[i].clear();
+      GroupCode[i].clear();
+      UseColumn[i] = false;
+      KeepCode[i].clear();
+   }
+
+   FcstLead.clear();
+   FcstValidBeg.clear();
+   FcstValidEnd.clear();
+   ObsLead.clear();
+   ObsValidBeg.clear();
+   ObsValidEnd.clear();
+
+   GroupFcstValidBegMax.clear();
+   GroupFcstValidEndMin.clear();
+   GroupObsValidBegMax.clear();
+   GroupObsValidEndMin.clear();
+
+   FiltFcstLead.clear();
+   FiltFcstValidBeg = (unixtime) 0;
+   FiltFcstValidEnd = (unixtime) 0;
+   FiltObsLead.clear();
+   FiltObsValidBeg  = (unixtime) 0;
+   FiltObsValidEnd  = (unixtime) 0;
+
+   Pos = 0;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+ConcatString STATCache::cache_file() const {
+   ConcatString cs;
+
+   cs << StatFile << stat_cache_file_ext;
+
+   return(cs);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool STATCache::get_file_info(const char *path, long long &size,
+                              long long &mtime) const {
+   struct stat sbuf;
+
+   if(stat(path, &sbuf) != 0) return(false);
+
+   size  = (long long) sbuf.st_size;
+   mtime = (long long) sbuf.st_mtime;
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Reset the cache and record the size and modification time of the
+// STAT file it describes.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool STATCache::set_file(const char *path) {
+
+   clear();
+
+   StatFile = path;
+
+   return(get_file_info(path, StatSize, StatMtime));
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Add a STAT line to the cache, where beg and end are the offsets in
+// the STAT file before and after reading it.
+//
+////////////////////////////////////////////////////////////////////////
+
+void STATCache::add(const STATLine &line, long long beg, long long end) {
+   const char *val[n_stat_cache_columns];
+   map<string,int>::const_iterator it;
+   int i, code;
+
+   Beg.push_back(beg);
+   End.push_back(end);
+   NRows++;
+
+   //
+   // Header lines have no column data
+   //
+   if(line.is_header()) {
+      IsHeader.push_back(1);
+      for(i=0; i<n_stat_cache_columns; i++) Code[i].push_back(-1);
+      FcstLead.push_back(bad_data_int);
+      FcstValidBeg.push_back((unixtime) 0);
+      FcstValidEnd.push_back((unixtime) 0);
+      ObsLead.push_back(bad_data_int);
+      ObsValidBeg.push_back((unixtime) 0);
+      ObsValidEnd.push_back((unixtime) 0);
+      return;
+   }
+
+   IsHeader.push_back(0);
+   NData++;
+
+   val[stat_cache_model]       = line.model();
+   val[stat_cache_desc]        = line.desc();
+   val[stat_cache_fcst_var]    = line.fcst_var();
+   val[stat_cache_fcst_units]  = line.fcst_units();
+   val[stat_cache_fcst_lev]    = line.fcst_lev();
+   val[stat_cache_obs_var]     = line.obs_var();
+   val[stat_cache_obs_units]   = line.obs_units();
+   val[stat_cache_obs_lev]     = line.obs_lev();
+   val[stat_cache_obtype]      = line.obtype();
+   val[stat_cache_vx_mask]     = line.vx_mask();
+   val[stat_cache_interp_mthd] = line.interp_mthd();
+   val[stat_cache_line_type]   = line.line_type();
+
+   //
+   // Look up or add the dictionary code for each string column
+   //
+   for(i=0; i<n_stat_cache_columns; i++) {
+      it = DictIndex[i].find(val[i]);
+      if(it == DictIndex[i].end()) {
+         code = Dict[i].n();
+         Dict[i].add(val[i]);
+         DictIndex[i][val[i]] = code;
+      }
+      else {
+         code = it->second;
+      }
+      Code[i].push_back(code);
+   }
+
+   FcstLead.push_back(line.fcst_lead());
+   FcstValidBeg.push_back(line.fcst_valid_beg());
+   FcstValidEnd.push_back(line.fcst_valid_end());
+   ObsLead.push_back(line.obs_lead());
+   ObsValidBeg.push_back(line.obs_valid_beg());
+   ObsValidEnd.push_back(line.obs_valid_end());
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Summarize each group of rows with the distinct codes of the string
+// columns and the range of the valid times.
+//
+////////////////////////////////////////////////////////////////////////
+
+void STATCache::build_groups() {
+   int i, j, k, n;
+   bool first;
+   vector<int> codes;
+
+   n = n_groups();
+
+   for(i=0; i<n_stat_cache_columns; i++) GroupCode[i].resize(n);
+
+   GroupFcstValidBegMax.assign(n, (unixtime) 0);
+   GroupFcstValidEndMin.assign(n, (unixtime) 0);
+   GroupObsValidBegMax.assign(n, (unixtime) 0);
+   GroupObsValidEndMin.assign(n, (unixtime) 0);
+
+   for(i=0; i<n; i++) {
+
+      for(k=0; k<n_stat_cache_columns; k++) {
+         codes.clear();
+         for(j=group_beg(i); j<group_end(i); j++) {
+            if(!IsHeader[j]) codes.push_back(Code[k][j]);
+         }
+         sort(codes.begin(), codes.end());
+         codes.erase(unique(codes.begin(), codes.end()), codes.end());
+         GroupCode[k][i] = codes;
+      }
+
+      for(j=group_beg(i), first=true; j<group_end(i); j++) {
+         if(IsHeader[j]) continue;
+         if(first || FcstValidBeg[j] > GroupFcstValidBegMax[i]) GroupFcstValidBegMax[i] = FcstValidBeg[j];
+         if(first || FcstValidEnd[j] < GroupFcstValidEndMin[i]) GroupFcstValidEndMin[i] = FcstValidEnd[j];
+         if(first || ObsValidBeg[j]  > GroupObsValidBegMax[i])  GroupObsValidBegMax[i]  = ObsValidBeg[j];
+         if(first || ObsValidEnd[j]  < GroupObsValidEndMin[i])  GroupObsValidEndMin[i]  = ObsValidEnd[j];
+         first = false;
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Read the cache for a STAT file.  Return false if it does not exist,
+// cannot be read, or is out of date with respect to the STAT file.
+// In that case, the object is left ready for the cache to be rebuilt.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool STATCache::read(const char *path) {
+   ifstream in;
+   char magic[sizeof(stat_cache_magic)];
+   int version, byte_order, n_col, group_size, n_dict, len, i, j;
+   long long size, mtime;
+   vector<char> buf;
+   bool status = true;
+
+   if(!set_file(path)) return(false);
+
+   in.open(cache_file().c_str(), ios::in | ios::binary);
+   if(!in) return(false);
+
+   //
+   // Check the file identification and the STAT file status
+   //
+   in.read(magic, sizeof(magic));
+   if(!in ||
+      strncmp(magic, stat_cache_magic, sizeof(magic)) != 0 ||
+      !read_value(in, version)    || version    != stat_cache_version     ||
+      !read_value(in, byte_order) || byte_order != stat_cache_byte_order  ||
+      !read_value(in, size)       || size       != StatSize               ||
+      !read_value(in, mtime)      || mtime      != StatMtime              ||
+      !read_value(in, NRows)      || NRows < 0                            ||
+      !read_value(in, NData)      || NData < 0  || NData > NRows          ||
+      !read_value(in, n_col)      || n_col      != n_stat_cache_columns   ||
+      !read_value(in, group_size) || group_size != stat_cache_group_size) {
+      status = false;
+   }
+
+   //
+   // Dictionaries for the string columns
+   //
+   for(i=0; status && i<n_stat_cache_columns; i++) {
+      if(!read_value(in, n_dict) || n_dict < 0) { status = false; break; }
+      for(j=0; j<n_dict; j++) {
+         if(!read_value(in, len) || len < 0 ||
+            !read_column(in, buf, len)) { status = false; break; }
+         Dict[i].add(string(buf.begin(), buf.end()));
+      }
+   }
+
+   //
+   // Column data
+   //
+   if(status) {
+      status = read_column(in, Beg,      NRows) &&
+               read_column(in, End,      NRows) &&
+               read_column(in, IsHeader, NRows);
+   }
+
+   for(i=0; status && i<n_stat_cache_columns; i++) {
+      status = read_column(in, Code[i], NRows);
+   }
+
+   if(status) {
+      status = read_column(in, FcstLead,     NRows) &&
+               read_column(in, FcstValidBeg, NRows) &&
+               read_column(in, FcstValidEnd, NRows) &&
+               read_column(in, ObsLead,      NRows) &&
+               read_column(in, ObsValidBeg,  NRows) &&
+               read_column(in, ObsValidEnd,  NRows);
+   }
+
+   in.close();
+
+   //
+   // Check for codes out of range
+   //
+   for(i=0; status && i<n_stat_cache_columns; i++) {
+      for(j=0; j<NRows; j++) {
+         if(Code[i][j] >= Dict[i].n() ||
+            (Code[i][j] < 0 && !IsHeader[j])) { status = false; break; }
+      }
+   }
+
+   if(!status) {
+      mlog << Debug(4) << "STATCache::read() -> "
+           << "ignoring out of date or invalid cache file \""
+           << cache_file() << "\".\n";
+      set_file(path);
+      return(false);
+   }
+
+   build_groups();
+
+   mlog << Debug(4) << "Read " << NRows << " rows from cache file \""
+        << cache_file() << "\".\n";
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Write the cache to a temporary file and move it into place.  Return
+// false if the STAT file changed while the cache was being built or
+// if the cache file cannot be written.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool STATCache::write() {
+   ofstream out;
+   ConcatString tmp_path;
+   long long size, mtime;
+   int i, j, n_dict, len;
+   int n_col = n_stat_cache_columns;
+   int group_size = stat_cache_group_size;
+
+   if(!get_file_info(StatFile.c_str(), size, mtime) ||
+      size != StatSize || mtime != StatMtime) {
+      mlog << Debug(3) << "STATCache::write() -> "
+           << "not writing cache file for \"" << StatFile
+           << "\" since it changed while being read.\n";
+      return(false);
+   }
+
+   tmp_path = make_temp_file_name(cache_file().c_str(), nullptr);
+
+   out.open(tmp_path.c_str(), ios::out | ios::binary);
+   if(!out) {
+      mlog << Debug(3) << "STATCache::write() -> "
+           << "unable to write cache file \"" << cache_file()
+           << "\".\n";
+      return(false);
+   }
+
+   out.write(stat_cache_magic, sizeof(stat_cache_magic));
+   write_value(out, stat_cache_version);
+   write_value(out, stat_cache_byte_order);
+   write_value(out, StatSize);
+   write_value(out, StatMtime);
+   write_value(out, NRows);
+   write_value(out, NData);
+   write_value(out, n_col);
+   write_value(out, group_size);
+
+   for(i=0; i<n_stat_cache_columns; i++) {
+      n_dict = Dict[i].n();
+      write_value(out, n_dict);
+      for(j=0; j<n_dict; j++) {
+         len = Dict[i][j].length();
+         write_value(out, len);
+         out.write(Dict[i][j].c_str(), len);
+      }
+   }
+
+   write_column(out, Beg);
+   write_column(out, End);
+   write_column(out, IsHeader);
+
+   for(i=0; i<n_stat_cache_columns; i++) write_column(out, Code[i]);
+
+   write_column(out, FcstLead);
+   write_column(out, FcstValidBeg);
+   write_column(out, FcstValidEnd);
+   write_column(out, ObsLead);
+   write_column(out, ObsValidBeg);
+   write_column(out, ObsValidEnd);
+
+   out.close();
+
+   if(!out || rename(tmp_path.c_str(), cache_file().c_str()) != 0) {
+      mlog << Debug(3) << "STATCache::write() -> "
+           << "unable to write cache file \"" << cache_file()
+           << "\".\n";
+      remove(tmp_path.c_str());
+      return(false);
+   }
+
+   mlog << Debug(4) << "Wrote " << NRows << " rows to cache file \""
+        << cache_file() << "\".\n";
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Store the job filtering criteria which can be checked using the
+// cached columns.  The remaining criteria are checked by
+// STATAnalysisJob::is_keeper() for the candidate lines.
+//
+////////////////////////////////////////////////////////////////////////
+
+void STATCache::set_filter(const STATAnalysisJob &job) {
+   const StringArray *sa[n_stat_cache_columns];
+   int i, j;
+
+   sa[stat_cache_model]       = &job.model;
+   sa[stat_cache_desc]        = &job.desc;
+   sa[stat_cache_fcst_var]    = &job.fcst_var;
+   sa[stat_cache_fcst_units]  = &job.fcst_units;
+   sa[stat_cache_fcst_lev]    = &job.fcst_lev;
+   sa[stat_cache_obs_var]     = &job.obs_var;
+   sa[stat_cache_obs_units]   = &job.obs_units;
+   sa[stat_cache_obs_lev]     = &job.obs_lev;
+   sa[stat_cache_obtype]      = &job.obtype;
+   sa[stat_cache_vx_mask]     = &job.vx_mask;
+   sa[stat_cache_interp_mthd] = &job.interp_mthd;
+   sa[stat_cache_line_type]   = &job.line_type;
+
+   //
+   // Check each dictionary entry once rather than each row
+   //
+   for(i=0; i<n_stat_cache_columns; i++) {
+      UseColumn[i] = (sa[i]->n() > 0);
+      KeepCode[i].assign(Dict[i].n(), true);
+      if(!UseColumn[i]) continue;
+      for(j=0; j<Dict[i].n(); j++) KeepCode[i][j] = sa[i]->has(Dict[i][j]);
+   }
+
+   FiltFcstLead     = job.fcst_lead;
+   FiltFcstValidBeg = job.fcst_valid_beg;
+   FiltFcstValidEnd = job.fcst_valid_end;
+   FiltObsLead      = job.obs_lead;
+   FiltObsValidBeg  = job.obs_valid_beg;
+   FiltObsValidEnd  = job.obs_valid_end;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool STATCache::keep_group(int i) const {
+   int j, k;
+   bool keep;
+
+   for(k=0; k<n_stat_cache_columns; k++) {
+
+      if(!UseColumn[k]) continue;
+
+      for(j=0, keep=false; j<(int) GroupCode[k][i].size(); j++) {
+         if(KeepCode[k][GroupCode[k][i][j]]) { keep = true; break; }
+      }
+
+      if(!keep) return(false);
+   }
+
+   if(FiltFcstValidBeg > 0 && GroupFcstValidBegMax[i] < FiltFcstValidBeg) return(false);
+   if(FiltFcstValidEnd > 0 && GroupFcstValidEndMin[i] > FiltFcstValidEnd) return(false);
+   if(FiltObsValidBeg  > 0 && GroupObsValidBegMax[i]  < FiltObsValidBeg)  return(false);
+   if(FiltObsValidEnd  > 0 && GroupObsValidEndMin[i]  > FiltObsValidEnd)  return(false);
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool STATCache::keep_row(int i) const {
+   int k;
+
+   for(k=0; k<n_stat_cache_columns; k++) {
+      if(UseColumn[k] && !KeepCode[k][Code[k][i]]) return(false);
+   }
+
+   if(FiltFcstLead.n() > 0 && !FiltFcstLead.has(FcstLead[i])) return(false);
+   if(FiltObsLead.n()  > 0 && !FiltObsLead.has(ObsLead[i]))    return(false);
+
+   if(FiltFcstValidBeg > 0 && FcstValidBeg[i] < FiltFcstValidBeg) return(false);
+   if(FiltFcstValidEnd > 0 && FcstValidEnd[i] > FiltFcstValidEnd) return(false);
+   if(FiltObsValidBeg  > 0 && ObsValidBeg[i]  < FiltObsValidBeg)  return(false);
+   if(FiltObsValidEnd  > 0 && ObsValidEnd[i]  > FiltObsValidEnd)  return(false);
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Read the line for a row from the STAT file, seeking only when the
+// row does not directly follow the previous one read.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool STATCache::read_row(LineDataFile &f, int i, STATLine &line) {
+
+   if(Beg[i] != Pos) {
+      f.in->clear();
+      f.in->seekg((streamoff) Beg[i]);
+   }
+
+   if(!(f >> line)) {
+      Pos = -1;
+      return(false);
+   }
+
+   Pos = End[i];
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,211 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+#ifndef  __STAT_CACHE_H__
+#define  __STAT_CACHE_H__
+
+////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "vx_util.h"
+#include "vx_cal.h"
+
+#include "stat_line.h"
+#include "stat_job.h"
+
+////////////////////////////////////////////////////////////////////////
+//
+// Binary sidecar index for an ASCII STAT file.
+//
+// The header columns used for filtering are stored one column at a
+// time, with the string columns dictionary-encoded and the timing
+// columns as typed arrays.  The rows are split into fixed-size groups
+// with per-group summaries so that filtering can skip whole groups.
+// The ASCII file remains the source of the data: each row records the
+// byte range of its line so that only the candidate lines are parsed.
+//
+// The cache is invalidated when the size or modification time of the
+// STAT file changes.
+//
+////////////////////////////////////////////////////////////////////////
+
+static const char stat_cache_file_ext[] = ".cache";
+
+static const int  stat_cache_group_size = 1024;
+
+////////////////////////////////////////////////////////////////////////
+
+enum STATCacheColumn {
+   stat_cache_model,
+   stat_cache_desc,
+   stat_cache_fcst_var,
+   stat_cache_fcst_units,
+   stat_cache_fcst_lev,
+   stat_cache_obs_var,
+   stat_cache_obs_units,
+   stat_cache_obs_lev,
+   stat_cache_obtype,
+   stat_cache_vx_mask,
+   stat_cache_interp_mthd,
+   stat_cache_line_type,
+
+   n_stat_cache_columns
+};
+
+////////////////////////////////////////////////////////////////////////
+
+class STATCache {
+
+   private:
+
+      void init_from_scratch();
+
+      STATCache(const STATCache &);
+      STATCache & operator=(const STATCache &);
+
+      ConcatString StatFile;
+      long long    StatSize;
+      long long    StatMtime;
+
+      int NRows;
+      int NData;
+
+         //
+         // Byte range of each line in the STAT file
+         //
+
+      std::vector<long long> Beg;
+      std::vector<long long> End;
+      std::vector<char>      IsHeader;
+
+         //
+         // Dictionary-encoded string columns
+         //
+
+      StringArray      Dict[n_stat_cache_columns];
+      std::vector<int> Code[n_stat_cache_columns];
+
+      std::map<std::string,int> DictIndex[n_stat_cache_columns];
+
+         //
+         // Typed timing columns
+         //
+
+      std::vector<int>      FcstLead;
+      std::vector<unixtime> FcstValidBeg;
+      std::vector<unixtime> FcstValidEnd;
+      std::vector<int>      ObsLead;
+      std::vector<unixtime> ObsValidBeg;
+      std::vector<unixtime> ObsValidEnd;
+
+         //
+         // Per-group summaries: distinct codes of each string column
+         // and the range of the valid times
+         //
+
+      std::vector< std::vector<int> > GroupCode[n_stat_cache_columns];
+
+      std::vector<unixtime> GroupFcstValidBegMax;
+      std::vector<unixtime> GroupFcstValidEndMin;
+      std::vector<unixtime> GroupObsValidBegMax;
+      std::vector<unixtime> GroupObsValidEndMin;
+
+         //
+         // Filtering criteria set by set_filter()
+         //
+
+      bool              UseColumn[n_stat_cache_columns];
+      std::vector<bool> KeepCode[n_stat_cache_columns];
+
+      IntArray FiltFcstLead;
+      unixtime FiltFcstValidBeg;
+      unixtime FiltFcstValidEnd;
+      IntArray FiltObsLead;
+      unixtime FiltObsValidBeg;
+      unixtime FiltObsValidEnd;
+
+         //
+         // Current read position in the STAT file
+         //
+
+      long long Pos;
+
+      bool get_file_info(const char *, long long &, long long &) const;
+
+      void build_groups();
+
+   public:
+
+      STATCache();
+     ~STATCache();
+
+      void clear();
+
+         //
+         //  building and storing the cache
+         //
+
+      bool set_file(const char *);
+
+      void add(const STATLine &, long long beg, long long end);
+
+      bool read(const char *);
+
+      bool write();
+
+         //
+         //  filtering
+         //
+
+      void set_filter(const STATAnalysisJob &);
+
+      bool keep_group(int) const;
+
+      bool keep_row(int) const;
+
+      bool read_row(LineDataFile &, int, STATLine &);
+
+         //
+         //  retrieve stuff
+         //
+
+      ConcatString cache_file() const;
+
+      int n_rows() const;
+
+      int n_data_rows() const;
+
+      int n_groups() const;
+
+      int group_beg(int) const;
+
+      int group_end(int) const;
+
+      bool is_header(int) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline int  STATCache::n_rows()        const { return(NRows); }
+inline int  STATCache::n_data_rows()   const { return(NData); }
+inline int  STATCache::n_groups()      const { return((NRows + stat_cache_group_size - 1) / stat_cache_group_size); }
+inline int  STATCache::group_beg(int i) const { return(i*stat_cache_group_size); }
+inline int  STATCache::group_end(int i) const { return((i+1)*stat_cache_group_size < NRows ? (i+1)*stat_cache_group_size : NRows); }
+inline bool STATCache::is_header(int i) const { return(IsHeader[i] != 0); }
+
+////////////////////////////////////////////////////////////////////////
+
+#endif   //  __STAT_CACHE_H__
+
+////////////////////////////////////////////////////////////////////////
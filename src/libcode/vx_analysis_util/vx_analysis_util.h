@@ -24,6 +24,7 @@
 #include "time_series.h"
 #include "stat_job.h"
 #include "stat_line.h"
+#include "stat_cache.h"
 
 ////////////////////////////////////////////////////////////////////////
 
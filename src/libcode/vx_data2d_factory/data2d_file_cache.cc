@@ -0,0 +1,231 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+#include <iostream>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include "data2d_file_cache.h"
+#include "data2d_factory.h"
+#include "grdfiletype_to_string.h"
+
+#include "vx_log.h"
+
+////////////////////////////////////////////////////////////////////////
+
+Met2dDataFileCache mtddf_cache;
+
+////////////////////////////////////////////////////////////////////////
+
+static bool get_file_info(const char *path, long long &size,
+                          long long &mtime) {
+   struct stat sbuf;
+
+   if(stat(path, &sbuf) != 0) return(false);
+
+   size  = (long long) sbuf.st_size;
+   mtime = (long long) sbuf.st_mtime;
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+//  Code for class Met2dDataFileCache
+//
+////////////////////////////////////////////////////////////////////////
+
+Met2dDataFileCache::Met2dDataFileCache() {
+
+   init_from_scratch();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+Met2dDataFileCache::~Met2dDataFileCache() {
+
+   clear();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void Met2dDataFileCache::init_from_scratch() {
+
+   LimitsSet = false;
+   MaxFiles  = default_data_file_cache_size;
+   MaxBytes  = (long long) default_data_file_cache_mb * 1024 * 1024;
+   NBytes    = 0;
+   UseCount  = 0;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void Met2dDataFileCache::clear() {
+
+   for(int i=0; i<(int) Entries.size(); i++) {
+      if(Entries[i].File) { delete Entries[i].File; Entries[i].File = (Met2dDataFile *) 0; }
+   }
+
+   Entries.clear();
+   NBytes = 0;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void Met2dDataFileCache::set_limits() {
+   ConcatString cs;
+
+   if(LimitsSet) return;
+
+   if(get_env("MET_DATA_FILE_CACHE_SIZE", cs) && cs.nonempty()) {
+      MaxFiles = atoi(cs.c_str());
+   }
+
+   if(get_env("MET_DATA_FILE_CACHE_MB", cs) && cs.nonempty()) {
+      MaxBytes = (long long) atoi(cs.c_str()) * 1024 * 1024;
+   }
+
+   mlog << Debug(4) << "Met2dDataFileCache::set_limits() -> "
+        << "caching up to " << MaxFiles << " open data files using up to "
+        << MaxBytes / (1024 * 1024) << " MB.\n";
+
+   LimitsSet = true;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void Met2dDataFileCache::remove_entry(int i) {
+
+   mlog << Debug(4) << "Met2dDataFileCache::remove_entry() -> "
+        << "closing cached data file \"" << Entries[i].Filename << "\".\n";
+
+   if(Entries[i].File) { delete Entries[i].File; Entries[i].File = (Met2dDataFile *) 0; }
+
+   NBytes -= Entries[i].NBytes;
+
+   Entries.erase(Entries.begin() + i);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+Met2dDataFile * Met2dDataFileCache::get(const char *filename, GrdFileType type) {
+   Met2dDataFileFactory mtddf_factory;
+   Met2dDataFile *mtddf = (Met2dDataFile *) 0;
+   long long size, mtime;
+   int i, i_lru;
+
+   set_limits();
+
+   //
+   // Python embedding runs a script for each call, so never cache it
+   //
+   if(MaxFiles <= 0 ||
+      type == FileType_Python_Numpy ||
+      type == FileType_Python_Xarray ||
+      !get_file_info(filename, size, mtime)) {
+      return(mtddf_factory.new_met_2d_data_file(filename, type));
+   }
+
+   //
+   // Check for a match which is still up to date
+   //
+   for(i=0; i<(int) Entries.size(); i++) {
+
+      if(Entries[i].Filename != filename || Entries[i].Type != type) continue;
+
+      if(Entries[i].FileSize == size && Entries[i].FileMtime == mtime) {
+         Entries[i].LastUse = ++UseCount;
+         mlog << Debug(4) << "Met2dDataFileCache::get() -> "
+              << "reusing open data file \"" << filename << "\".\n";
+         return(Entries[i].File);
+      }
+
+      remove_entry(i);
+      break;
+   }
+
+   //
+   // Open the file
+   //
+   if(!(mtddf = mtddf_factory.new_met_2d_data_file(filename, type))) {
+      return(mtddf);
+   }
+
+   //
+   // Skip python types determined from the file name
+   //
+   if(mtddf->file_type() == FileType_Python_Numpy ||
+      mtddf->file_type() == FileType_Python_Xarray) {
+      return(mtddf);
+   }
+
+   //
+   // Estimate the memory use from the size of the grid
+   //
+   CacheEntry e;
+   e.Filename  = filename;
+   e.Type      = type;
+   e.FileSize  = size;
+   e.FileMtime = mtime;
+   e.NBytes    = (long long) mtddf->raw_nx() * mtddf->raw_ny() * sizeof(double);
+   e.LastUse   = ++UseCount;
+   e.File      = mtddf;
+
+   Entries.push_back(e);
+   NBytes += e.NBytes;
+
+   //
+   // Close the least recently used files, other than the new one
+   //
+   while((int) Entries.size() > 1 &&
+         ((int) Entries.size() > MaxFiles || NBytes > MaxBytes)) {
+
+      for(i=0, i_lru=0; i<(int) Entries.size()-1; i++) {
+         if(Entries[i].LastUse < Entries[i_lru].LastUse) i_lru = i;
+      }
+
+      remove_entry(i_lru);
+   }
+
+   return(mtddf);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Delete the object if it is not owned by the cache.
+//
+////////////////////////////////////////////////////////////////////////
+
+void Met2dDataFileCache::release(Met2dDataFile *&mtddf) {
+
+   if(!mtddf) return;
+
+   for(int i=0; i<(int) Entries.size(); i++) {
+      if(Entries[i].File == mtddf) { mtddf = (Met2dDataFile *) 0; return; }
+   }
+
+   delete mtddf;
+   mtddf = (Met2dDataFile *) 0;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
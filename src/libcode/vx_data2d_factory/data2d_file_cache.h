@@ -0,0 +1,109 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifndef __MET_2D_DATA_FILE_CACHE_H__
+#define __MET_2D_DATA_FILE_CACHE_H__
+
+///////////////////////////////////////////////////////////////////////////////
+
+#include <vector>
+
+#include "data_class.h"
+#include "concat_string.h"
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Least recently used cache of opened Met2dDataFile objects, so that
+// reading several fields from the same file reuses the open file, its
+// inventory, and its grid.
+//
+// The MET_DATA_FILE_CACHE_SIZE environment variable sets the maximum
+// number of open files (0 disables the cache) and MET_DATA_FILE_CACHE_MB
+// sets the ceiling on their estimated memory use.
+//
+// The pointer returned by get() is owned by the cache and remains valid
+// until the next call to get().  Pass it to release() when done with it.
+// Tools call clear() when cleaning up, so that the cached files are
+// closed, and their temporary files removed, before static destruction.
+//
+///////////////////////////////////////////////////////////////////////////////
+
+static const int default_data_file_cache_size = 8;
+static const int default_data_file_cache_mb   = 1024;
+
+///////////////////////////////////////////////////////////////////////////////
+
+class Met2dDataFileCache {
+
+   private:
+
+      struct CacheEntry {
+         ConcatString    Filename;
+         GrdFileType     Type;
+         long long       FileSize;
+         long long       FileMtime;
+         long long       NBytes;
+         unsigned long   LastUse;
+         Met2dDataFile * File;     //  allocated
+      };
+
+      Met2dDataFileCache(const Met2dDataFileCache &);
+      Met2dDataFileCache & operator=(const Met2dDataFileCache &);
+
+      void init_from_scratch();
+
+      void set_limits();
+
+      void remove_entry(int);
+
+      std::vector<CacheEntry> Entries;
+
+      bool          LimitsSet;
+      int           MaxFiles;
+      long long     MaxBytes;
+      long long     NBytes;
+      unsigned long UseCount;
+
+   public:
+
+      Met2dDataFileCache();
+     ~Met2dDataFileCache();
+
+      void clear();
+
+         //
+         //  get stuff
+         //
+
+      int n_files() const;
+
+         //
+         //  do stuff
+         //
+
+      Met2dDataFile * get(const char *filename, GrdFileType type);
+
+      void release(Met2dDataFile *&);
+
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+inline int Met2dDataFileCache::n_files() const { return((int) Entries.size()); }
+
+///////////////////////////////////////////////////////////////////////////////
+
+extern Met2dDataFileCache mtddf_cache;
+
+///////////////////////////////////////////////////////////////////////////////
+
+#endif  // __MET_2D_DATA_FILE_CACHE_H__
+
+///////////////////////////////////////////////////////////////////////////////
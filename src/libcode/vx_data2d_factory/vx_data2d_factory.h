@@ -22,6 +22,7 @@
 
 
 #include "data2d_factory.h"
+#include "data2d_file_cache.h"
 #include "data2d_factory_utils.h"
 #include "is_bufr_file.h"
 #include "is_grib_file.h"
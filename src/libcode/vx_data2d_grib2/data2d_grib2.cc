@@ -24,12 +24,16 @@ using namespace std;
 #include <utility>
 #include <limits>
 #include <list>
+#include <algorithm>
+#include <fstream>
+#include <sys/stat.h>
 
 #include "data2d_grib2.h"
 #include "grib_strings.h"
 #include "vx_data2d.h"
 #include "vx_math.h"
 #include "vx_log.h"
+#include "hash_util.h"
 
 extern "C" {
   #include "grib2.h"
@@ -109,7 +113,15 @@ bool MetGrib2DataFile::open(const char * _filename) {
       exit(1);
    }
 
-   if( 1 > RecList.size() ) read_grib2_record_list();
+   //  use the inventory from a previous open of the same file, if
+   //  available, rather than scanning the file
+   if( 1 > RecList.size() ){
+      if( !read_grib2_inventory() ){
+         read_grib2_record_list();
+         write_grib2_inventory();
+      }
+      build_grib2_record_lookup();
+   }
 
    bool status = ( 0 < RecList.size() );
    if( !status ){
@@ -410,9 +422,36 @@ void MetGrib2DataFile::find_record_matches( VarInfoGrib2* vinfo,
       }
    }
 
-   //  check each record for a match against the VarInfo
-   for( vector<Grib2Record*>::iterator it = RecList.begin();
-        it < RecList.end();
+   //  only records matching the record number, the parameter name, or
+   //  the discipline, category, and parameter can match the VarInfo
+   vector<int> cand_idx;
+   map<int,vector<int> >::const_iterator num_it;
+   map<string,vector<int> >::const_iterator str_it;
+   ConcatString parm_id;
+   parm_id << vinfo->discipline() << "_" << vinfo->parm_cat() << "_" << vinfo->parm();
+
+   if( RecNumIndex.end() != (num_it = RecNumIndex.find(vinfo->record())) ){
+      cand_idx.insert(cand_idx.end(), num_it->second.begin(), num_it->second.end());
+   }
+   if( ParmIndex.end() != (str_it = ParmIndex.find(parm_id.text())) ){
+      cand_idx.insert(cand_idx.end(), str_it->second.begin(), str_it->second.end());
+   }
+   if( NameIndex.end() != (str_it = NameIndex.find(vinfo->name().text())) ){
+      cand_idx.insert(cand_idx.end(), str_it->second.begin(), str_it->second.end());
+   }
+
+   //  preserve the order of the records in the file
+   sort(cand_idx.begin(), cand_idx.end());
+   cand_idx.erase(unique(cand_idx.begin(), cand_idx.end()), cand_idx.end());
+
+   vector<Grib2Record*> cand_list;
+   for( vector<int>::iterator idx_it = cand_idx.begin();
+        idx_it < cand_idx.end();
+        idx_it++ ) cand_list.push_back(RecList[*idx_it]);
+
+   //  check each candidate record for a match against the VarInfo
+   for( vector<Grib2Record*>::iterator it = cand_list.begin();
+        it < cand_list.end();
         it++ ) {
 
       bool rec_match_ex = false;
@@ -567,7 +606,7 @@ void MetGrib2DataFile::find_record_matches( VarInfoGrib2* vinfo,
       if( rec_match_ex )                 listMatchExact.push_back(*it);
       if( rec_match_ex || rec_match_rn ) listMatchRange.push_back(*it);
 
-   }  //  END:  for( vector<Grib2Record*>::iterator it = RecList.begin(); ...)
+   }  //  END:  for( vector<Grib2Record*>::iterator it = cand_list.begin(); ...)
 
    return;
 }
@@ -722,6 +761,19 @@ void MetGrib2DataFile::read_grib2_record_list() {
 
          //  store the record information
          Grib2Record *rec = new Grib2Record;
+
+         //  initialize the template-specific values
+         rec->Process             = bad_data_int;
+         rec->EnsType             = bad_data_int;
+         rec->EnsNumber           = bad_data_int;
+         rec->DerType             = bad_data_int;
+         rec->StatType            = bad_data_int;
+         rec->PercVal             = bad_data_int;
+         rec->AerosolType         = bad_data_int;
+         rec->AerosolIntervalType = bad_data_int;
+         rec->AerosolSizeLower    = bad_data_double;
+         rec->AerosolSizeUpper    = bad_data_double;
+
          rec->ByteOffset   = offset;
          rec->Index        = idx++;
          rec->NumFields    = (int)numfields;
@@ -731,6 +783,9 @@ void MetGrib2DataFile::read_grib2_record_list() {
          rec->PdsTmpl      = gfld->ipdtnum;
          rec->ParmCat      = gfld->ipdtmpl[0];
          rec->Parm         = gfld->ipdtmpl[1];
+         rec->Center       = gfld->idsect[0];
+         rec->MasterTable  = gfld->idsect[2];
+         rec->LocalTable   = gfld->idsect[3];
 
          //  get the process id
          if( gfld->ipdtnum != 46 && gfld->ipdtnum != 48 ) {
@@ -931,30 +986,12 @@ void MetGrib2DataFile::read_grib2_record_list() {
          double sec_accum_unit = VarInfoGrib2::g2_time_range_unit_to_sec( range_typ );
          rec->Accum = range_val * (int)sec_accum_unit;
 
-         //  build the parameter "name"
-         ConcatString id;
-         id << rec->Discipline << "_" << rec->ParmCat << "_" << rec->Parm;
-
          //  use the index to look up the parameter name
-         Grib2TableEntry tab;
-         if( !GribTable.lookup_grib2(rec->Discipline, rec->ParmCat, rec->Parm,
-                                     gfld->idsect[2], gfld->idsect[0], gfld->idsect[3], tab) ){
-            mlog << Debug(4) << "MetGrib2DataFile::read_grib2_record_list() - unrecognized GRIB2 "
-                 << "field indexes - disc: " << rec->Discipline << ", master table: " << gfld->idsect[2]
-                 << ", center: " << gfld->idsect[0] << ", local table: " << gfld->idsect[3]
-                 << ", parm_cat: " << rec->ParmCat << ", parm: " << rec->Parm << "\n";
-            rec->ParmName = str_format("DISC%d_CAT%d_PARM%d", rec->Discipline, rec->ParmCat, rec->Parm);
-         } else {
-            rec->ParmName = tab.parm_name.text();
-         }
+         set_grib2_parm_name(rec, true);
 
          //  add the record to the list
          RecList.push_back(rec);
 
-         //  build data structure for U/V wind pairs
-         string rec_mag = build_magic(rec).text();
-         NameRecMap[rec_mag] = rec;
-
          g2_free(gfld);
 
          //  if there are more fields in the current record, read the next one
@@ -1593,6 +1630,402 @@ long MetGrib2DataFile::read_grib2_record(long offset, g2int unpack,
 
 ////////////////////////////////////////////////////////////////////////
 
+void MetGrib2DataFile::set_grib2_parm_name(Grib2Record *rec, bool verbose) {
+
+   //  use the index to look up the parameter name
+   Grib2TableEntry tab;
+   if( !GribTable.lookup_grib2(rec->Discipline, rec->ParmCat, rec->Parm,
+                               rec->MasterTable, rec->Center, rec->LocalTable, tab) ){
+      if( verbose ){
+         mlog << Debug(4) << "MetGrib2DataFile::read_grib2_record_list() - unrecognized GRIB2 "
+              << "field indexes - disc: " << rec->Discipline << ", master table: " << rec->MasterTable
+              << ", center: " << rec->Center << ", local table: " << rec->LocalTable
+              << ", parm_cat: " << rec->ParmCat << ", parm: " << rec->Parm << "\n";
+      }
+      rec->ParmName = str_format("DISC%d_CAT%d_PARM%d", rec->Discipline, rec->ParmCat, rec->Parm);
+   } else {
+      rec->ParmName = tab.parm_name.text();
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void MetGrib2DataFile::build_grib2_record_lookup() {
+
+   RecNumIndex.clear();
+   NameIndex.clear();
+   ParmIndex.clear();
+   NameRecMap.clear();
+
+   for(int i=0; i < (int) RecList.size(); i++){
+      Grib2Record *rec = RecList[i];
+
+      ConcatString id;
+      id << rec->Discipline << "_" << rec->ParmCat << "_" << rec->Parm;
+
+      RecNumIndex[rec->RecNum].push_back(i);
+      ParmIndex[id.text()].push_back(i);
+      NameIndex[rec->ParmName].push_back(i);
+
+      //  build data structure for U/V wind pairs
+      string rec_mag = build_magic(rec).text();
+      NameRecMap[rec_mag] = rec;
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// The record inventory of each GRIB2 file is kept in memory and reused
+// when the same file is opened again.  At most
+// max_grib2_inventory_cache_size inventories are kept in memory, and
+// the least recently used one is dropped when the cache is full.  If
+// the MET_GRIB2_INDEX_DIR environment variable is set, the inventory
+// is also written to an index file in that directory and reused
+// across runs.  Both are keyed by the file
+// path and invalidated when its size or modification time changes.
+//
+////////////////////////////////////////////////////////////////////////
+
+struct Grib2Inventory {
+   long long FileSize;
+   long long FileMtime;
+   unsigned long LastUse;
+   vector<Grib2Record> RecList;
+};
+
+static map<string,Grib2Inventory> grib2_inventory_cache;
+static unsigned long grib2_inventory_use_count = 0;
+
+static const int max_grib2_inventory_cache_size = 32;
+
+static const char grib2_index_dir_env[] = "MET_GRIB2_INDEX_DIR";
+static const char grib2_index_magic[]   = "MET_GRIB2_INDEX";
+static const int  grib2_index_version   = 1;
+
+////////////////////////////////////////////////////////////////////////
+
+static bool get_grib2_file_info(const string &path, long long &size,
+                                long long &mtime) {
+   struct stat sbuf;
+
+   if( 0 != stat(path.c_str(), &sbuf) ) return false;
+
+   size  = (long long) sbuf.st_size;
+   mtime = (long long) sbuf.st_mtime;
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void store_grib2_inventory(const string &path,
+                                  const Grib2Inventory &inv) {
+
+   //  remove the least recently used inventory to make room
+   if( grib2_inventory_cache.end() == grib2_inventory_cache.find(path) &&
+       max_grib2_inventory_cache_size <= (int) grib2_inventory_cache.size() ){
+      map<string,Grib2Inventory>::iterator it, lru;
+      lru = grib2_inventory_cache.begin();
+      for(it = grib2_inventory_cache.begin(); it != grib2_inventory_cache.end(); it++){
+         if( it->second.LastUse < lru->second.LastUse ) lru = it;
+      }
+      grib2_inventory_cache.erase(lru);
+   }
+
+   Grib2Inventory &entry = grib2_inventory_cache[path];
+   entry = inv;
+   entry.LastUse = ++grib2_inventory_use_count;
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static ConcatString get_grib2_real_path(const string &path) {
+   char buf[PATH_MAX];
+   ConcatString cs;
+
+   cs = ( nullptr != realpath(path.c_str(), buf) ? buf : path.c_str() );
+
+   return cs;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+static void write_grib2_index_value(ofstream &out, const T &v) {
+   out.write((const char *) &v, sizeof(T));
+}
+
+////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+static void read_grib2_index_value(ifstream &in, T &v) {
+   in.read((char *) &v, sizeof(T));
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void write_grib2_index_record(ofstream &out, const Grib2Record &rec) {
+
+   write_grib2_index_value(out, rec.ByteOffset);
+   write_grib2_index_value(out, rec.Index);
+   write_grib2_index_value(out, rec.NumFields);
+   write_grib2_index_value(out, rec.RecNum);
+   write_grib2_index_value(out, rec.FieldNum);
+   write_grib2_index_value(out, rec.Discipline);
+   write_grib2_index_value(out, rec.PdsTmpl);
+   write_grib2_index_value(out, rec.ParmCat);
+   write_grib2_index_value(out, rec.Parm);
+   write_grib2_index_value(out, rec.Process);
+   write_grib2_index_value(out, rec.LvlTyp);
+   write_grib2_index_value(out, rec.LvlVal1);
+   write_grib2_index_value(out, rec.LvlVal2);
+   write_grib2_index_value(out, rec.RangeTyp);
+   write_grib2_index_value(out, rec.RangeVal);
+   write_grib2_index_value(out, rec.ResCompFlag);
+   write_grib2_index_value(out, rec.ProbFlag);
+   write_grib2_index_value(out, rec.ProbLower);
+   write_grib2_index_value(out, rec.ProbUpper);
+   write_grib2_index_value(out, rec.ProbType);
+   write_grib2_index_value(out, rec.InitTime);
+   write_grib2_index_value(out, rec.ValidTime);
+   write_grib2_index_value(out, rec.LeadTime);
+   write_grib2_index_value(out, rec.Accum);
+   write_grib2_index_value(out, rec.EnsType);
+   write_grib2_index_value(out, rec.EnsNumber);
+   write_grib2_index_value(out, rec.DerType);
+   write_grib2_index_value(out, rec.StatType);
+   write_grib2_index_value(out, rec.PercVal);
+   write_grib2_index_value(out, rec.AerosolType);
+   write_grib2_index_value(out, rec.AerosolIntervalType);
+   write_grib2_index_value(out, rec.AerosolSizeLower);
+   write_grib2_index_value(out, rec.AerosolSizeUpper);
+   write_grib2_index_value(out, rec.Center);
+   write_grib2_index_value(out, rec.MasterTable);
+   write_grib2_index_value(out, rec.LocalTable);
+
+   int n = rec.IPDTmpl.n();
+   write_grib2_index_value(out, n);
+   for(int i=0; i < n; i++) write_grib2_index_value(out, rec.IPDTmpl[i]);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static bool read_grib2_index_record(ifstream &in, Grib2Record &rec) {
+
+   read_grib2_index_value(in, rec.ByteOffset);
+   read_grib2_index_value(in, rec.Index);
+   read_grib2_index_value(in, rec.NumFields);
+   read_grib2_index_value(in, rec.RecNum);
+   read_grib2_index_value(in, rec.FieldNum);
+   read_grib2_index_value(in, rec.Discipline);
+   read_grib2_index_value(in, rec.PdsTmpl);
+   read_grib2_index_value(in, rec.ParmCat);
+   read_grib2_index_value(in, rec.Parm);
+   read_grib2_index_value(in, rec.Process);
+   read_grib2_index_value(in, rec.LvlTyp);
+   read_grib2_index_value(in, rec.LvlVal1);
+   read_grib2_index_value(in, rec.LvlVal2);
+   read_grib2_index_value(in, rec.RangeTyp);
+   read_grib2_index_value(in, rec.RangeVal);
+   read_grib2_index_value(in, rec.ResCompFlag);
+   read_grib2_index_value(in, rec.ProbFlag);
+   read_grib2_index_value(in, rec.ProbLower);
+   read_grib2_index_value(in, rec.ProbUpper);
+   read_grib2_index_value(in, rec.ProbType);
+   read_grib2_index_value(in, rec.InitTime);
+   read_grib2_index_value(in, rec.ValidTime);
+   read_grib2_index_value(in, rec.LeadTime);
+   read_grib2_index_value(in, rec.Accum);
+   read_grib2_index_value(in, rec.EnsType);
+   read_grib2_index_value(in, rec.EnsNumber);
+   read_grib2_index_value(in, rec.DerType);
+   read_grib2_index_value(in, rec.StatType);
+   read_grib2_index_value(in, rec.PercVal);
+   read_grib2_index_value(in, rec.AerosolType);
+   read_grib2_index_value(in, rec.AerosolIntervalType);
+   read_grib2_index_value(in, rec.AerosolSizeLower);
+   read_grib2_index_value(in, rec.AerosolSizeUpper);
+   read_grib2_index_value(in, rec.Center);
+   read_grib2_index_value(in, rec.MasterTable);
+   read_grib2_index_value(in, rec.LocalTable);
+
+   int n = 0, v;
+   read_grib2_index_value(in, n);
+   if( !in || 0 > n ) return false;
+
+   rec.IPDTmpl.clear();
+   for(int i=0; i < n; i++){
+      read_grib2_index_value(in, v);
+      rec.IPDTmpl.add(v);
+   }
+
+   return (bool) in;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+ConcatString MetGrib2DataFile::grib2_index_file() const {
+   ConcatString dir, path;
+
+   if( !get_env(grib2_index_dir_env, dir) || dir.empty() ) return path;
+
+   //  hash the full path of the GRIB2 file
+   ConcatString real_path = get_grib2_real_path(Filename);
+   path.format("%s/grib2_index_%016llx.bin", dir.c_str(),
+               fnv1a_hash(real_path.c_str()));
+
+   return path;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool MetGrib2DataFile::read_grib2_inventory() {
+   long long size, mtime;
+   vector<Grib2Record> recs;
+   bool from_index = false;
+
+   if( !get_grib2_file_info(Filename, size, mtime) ) return false;
+
+   //  check for an inventory from a previous open in this process
+   map<string,Grib2Inventory>::iterator it = grib2_inventory_cache.find(Filename);
+   if( grib2_inventory_cache.end() != it &&
+       it->second.FileSize == size && it->second.FileMtime == mtime ){
+      it->second.LastUse = ++grib2_inventory_use_count;
+      recs = it->second.RecList;
+   }
+
+   //  check for an up to date index file
+   else {
+      ConcatString index_file = grib2_index_file();
+      if( index_file.empty() ) return false;
+
+      ifstream in(index_file.c_str(), ios::in | ios::binary);
+      if( !in ) return false;
+
+      char magic[sizeof(grib2_index_magic)];
+      int version = 0, n_rec = 0, n_path = 0;
+      long long idx_size = 0, idx_mtime = 0;
+      ConcatString real_path = get_grib2_real_path(Filename);
+
+      in.read(magic, sizeof(magic));
+      read_grib2_index_value(in, version);
+      read_grib2_index_value(in, idx_size);
+      read_grib2_index_value(in, idx_mtime);
+      read_grib2_index_value(in, n_path);
+      if( !in || 0 != strncmp(magic, grib2_index_magic, sizeof(magic)) ||
+          grib2_index_version != version ||
+          size != idx_size || mtime != idx_mtime ||
+          n_path != (int) real_path.length() ) return false;
+
+      vector<char> path_buf(n_path);
+      if( 0 < n_path ) in.read(path_buf.data(), n_path);
+      read_grib2_index_value(in, n_rec);
+      if( !in || real_path != string(path_buf.begin(), path_buf.end()) ||
+          0 > n_rec ) return false;
+
+      recs.resize(n_rec);
+      for(int i=0; i < n_rec; i++){
+         if( !read_grib2_index_record(in, recs[i]) ) return false;
+
+         //  look up the name using the current GRIB tables
+         set_grib2_parm_name(&recs[i], false);
+      }
+
+      Grib2Inventory inv;
+      inv.FileSize  = size;
+      inv.FileMtime = mtime;
+      inv.RecList   = recs;
+      store_grib2_inventory(Filename, inv);
+
+      from_index = true;
+      mlog << Debug(4) << "MetGrib2DataFile::read_grib2_inventory() - "
+           << "read " << n_rec << " records from GRIB2 index file: "
+           << index_file << "\n";
+   }
+
+   if( recs.empty() ) return false;
+
+   //  read the grid information from the first record
+   gribfield *gfld;
+   g2int numfields;
+   if( 0 > read_grib2_record(0, 0, 1, gfld, numfields) ) return false;
+   read_grib2_grid(gfld);
+   g2_free(gfld);
+
+   for(size_t i=0; i < recs.size(); i++) RecList.push_back(new Grib2Record(recs[i]));
+
+   mlog << Debug(4) << "MetGrib2DataFile::read_grib2_inventory() - "
+        << "reused the inventory of " << RecList.size() << " fields from "
+        << ( from_index ? "the index file" : "memory" )
+        << " for GRIB2 file: " << Filename << "\n";
+
+   return true;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void MetGrib2DataFile::write_grib2_inventory() {
+   long long size, mtime;
+
+   if( RecList.empty() || !get_grib2_file_info(Filename, size, mtime) ) return;
+
+   //  store the inventory for later opens in this process
+   Grib2Inventory inv;
+   inv.FileSize  = size;
+   inv.FileMtime = mtime;
+   for(size_t i=0; i < RecList.size(); i++) inv.RecList.push_back(*RecList[i]);
+   store_grib2_inventory(Filename, inv);
+
+   //  write the index file, if requested
+   ConcatString index_file = grib2_index_file();
+   if( index_file.empty() ) return;
+
+   ConcatString tmp_file = make_temp_file_name(index_file.c_str(), nullptr);
+   ConcatString real_path = get_grib2_real_path(Filename);
+   int n_path = real_path.length();
+   int n_rec = RecList.size();
+
+   ofstream out(tmp_file.c_str(), ios::out | ios::binary);
+   if( !out ){
+      mlog << Debug(3) << "MetGrib2DataFile::write_grib2_inventory() - "
+           << "unable to write GRIB2 index file: " << index_file << "\n";
+      return;
+   }
+
+   out.write(grib2_index_magic, sizeof(grib2_index_magic));
+   write_grib2_index_value(out, grib2_index_version);
+   write_grib2_index_value(out, size);
+   write_grib2_index_value(out, mtime);
+   write_grib2_index_value(out, n_path);
+   out.write(real_path.c_str(), n_path);
+   write_grib2_index_value(out, n_rec);
+   for(int i=0; i < n_rec; i++) write_grib2_index_record(out, *RecList[i]);
+   out.close();
+
+   if( !out || 0 != rename(tmp_file.c_str(), index_file.c_str()) ){
+      mlog << Debug(3) << "MetGrib2DataFile::write_grib2_inventory() - "
+           << "unable to write GRIB2 index file: " << index_file << "\n";
+      remove(tmp_file.c_str());
+      return;
+   }
+
+   mlog << Debug(4) << "MetGrib2DataFile::write_grib2_inventory() - "
+        << "wrote " << n_rec << " records to GRIB2 index file: "
+        << index_file << "\n";
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 ConcatString MetGrib2DataFile::build_magic(Grib2Record *rec){
    ConcatString lvl;
    int lvl_val1 = (int)rec->LvlVal1, lvl_val2 = (int)rec->LvlVal2;
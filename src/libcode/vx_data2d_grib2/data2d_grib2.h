@@ -66,6 +66,9 @@ typedef struct {
    int AerosolIntervalType;
    double AerosolSizeLower;
    double AerosolSizeUpper;
+   int Center;
+   int MasterTable;
+   int LocalTable;
    IntArray IPDTmpl;
 } Grib2Record;
 
@@ -89,6 +92,12 @@ class MetGrib2DataFile : public Met2dDataFile {
       map<string,string> PairMap;
       map<string,Grib2Record*> NameRecMap;
 
+      //  lookup tables from the record number, the parameter name, and
+      //  the discipline, category, and parameter to RecList indices
+      map<int,vector<int> >    RecNumIndex;
+      map<string,vector<int> > NameIndex;
+      map<string,vector<int> > ParmIndex;
+
       int ScanMode;
 
 
@@ -111,6 +120,16 @@ class MetGrib2DataFile : public Met2dDataFile {
 
       void read_grib2_record_list();
 
+      void set_grib2_parm_name(Grib2Record *rec, bool verbose);
+
+      void build_grib2_record_lookup();
+
+      bool read_grib2_inventory();
+
+      void write_grib2_inventory();
+
+      ConcatString grib2_index_file() const;
+
       DataPlane check_uv_rotation( VarInfoGrib2 *vinfo,
                                    Grib2Record *rec,
                                    DataPlane plane
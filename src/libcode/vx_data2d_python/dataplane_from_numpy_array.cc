@@ -20,26 +20,6 @@
 #include "grid_from_python_dict.h"
 
 
-////////////////////////////////////////////////////////////////////////
-
-
-   //
-   //  2D numpy arrays seem to store things in row-major order
-   //
-
-inline void numpy_array_one_to_two(const int n, const int Ncols, int & row, int & col)
-
-{
-
-row = n/Ncols;
-
-col = n%Ncols;
-
-return;
-
-}
-
-
 ////////////////////////////////////////////////////////////////////////
 
 
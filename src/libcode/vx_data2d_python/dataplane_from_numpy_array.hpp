@@ -15,9 +15,14 @@
 
 ////////////////////////////////////////////////////////////////////////
 
-extern inline void numpy_array_one_to_two(const int n, const int Ncols, int & row, int & col);
 
-////////////////////////////////////////////////////////////////////////
+   //
+   //  2D numpy arrays are stored in row-major order with rows running
+   //  north to south, so each row is copied into the flipped DataPlane
+   //  row in one pass.  Native data is widened to double in a tight
+   //  loop the compiler can vectorize, native doubles are copied
+   //  directly, and swapped data is byte-swapped in a scratch row.
+   //
 
 
 template <typename T>
@@ -32,26 +37,70 @@ void load_numpy (void * buf,
 
 bool need_swap = (shuf != 0) && (native_endian != data_endian);
 
-int j, x, y, r, c;
-const int Nxy = Nx*Ny;
-T * u = (T *) buf;
-T value;
+int x, r;
+const unsigned char * src = (const unsigned char *) buf;
+const size_t row_bytes = sizeof(T)*Nx;
+double * dp_buf = out.buf().data();
+double * dp_row = 0;
+std::vector<T> row(Nx);
+
+for (r=0; r<Ny; ++r)  {
+
+   dp_row = dp_buf + out.two_to_one(0, Ny - 1 - r);
+
+   memcpy(row.data(), src + r*row_bytes, row_bytes);
+
+   if ( need_swap )  {
+
+      for (x=0; x<Nx; ++x)  shuf(&row[x]);
+
+   }
+
+   for (x=0; x<Nx; ++x)  dp_row[x] = (double) row[x];
+
+}   //  for r
+
+
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+template <>
+inline void load_numpy <double> (void * buf,
+                                 const int Nx, const int Ny,
+                                 const int data_endian,
+                                 void (*shuf)(void *), 
+                                 DataPlane & out)
+
+
+{
+
+bool need_swap = (shuf != 0) && (native_endian != data_endian);
 
-for (j=0; j<Nxy; ++j)  {
+int x, r;
+const unsigned char * src = (const unsigned char *) buf;
+const size_t row_bytes = sizeof(double)*Nx;
+double * dp_buf = out.buf().data();
+double * dp_row = 0;
 
-   numpy_array_one_to_two(j, Nx, r, c);
+for (r=0; r<Ny; ++r)  {
 
-   x = c;
+   dp_row = dp_buf + out.two_to_one(0, Ny - 1 - r);
 
-   y = Ny - 1 - r;
+   memcpy(dp_row, src + r*row_bytes, row_bytes);
 
-   memcpy(&value, u + j, sizeof(T));
+   if ( need_swap )  {
 
-   if ( need_swap )  shuf(&value);
+      for (x=0; x<Nx; ++x)  shuf(dp_row + x);
 
-   out.set((double) value, x, y);
+   }
 
-}   //  for j
+}   //  for r
 
 
 
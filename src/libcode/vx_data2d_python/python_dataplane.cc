@@ -320,7 +320,7 @@ int j;
 int status;
 ConcatString command;
 ConcatString path;
-ConcatString tmp_nc_path;
+ConcatString tmp_raw_path;
 const char * tmp_dir = 0;
 Wchar_Argv wa;
 
@@ -334,14 +334,14 @@ if ( ! tmp_dir )  tmp_dir = default_tmp_dir;
 
 path << cs_erase
      << tmp_dir << '/'
-     << tmp_nc_base_name;
+     << tmp_raw_base_name;
 
-tmp_nc_path = make_temp_file_name(path.text(), 0);
+tmp_raw_path = make_temp_file_name(path.text(), 0);
 
 command << cs_erase
         << user_ppath                    << ' '    //  user's path to python
         << replace_path(write_tmp_nc)    << ' '    //  write_tmp_nc.py
-        << tmp_nc_path                   << ' '    //  tmp_nc output filename
+        << tmp_raw_path                  << ' '    //  tmp_raw output filename
         << user_script_name;                       //  user's script name
 
 for (j=1; j<user_script_argc; ++j)  {   //  j starts at one, here
@@ -399,14 +399,14 @@ a.add(validate_dataplane);
 
 a.add(replace_path(read_tmp_nc));
 
-a.add(tmp_nc_path);
+a.add(tmp_raw_path);
 
 wa.set(a);
 
 PySys_SetArgv (wa.wargc(), wa.wargv());
 
 mlog << Debug(4) << "Reading temporary Python dataplane file: "
-     << tmp_nc_path << "\n";
+     << tmp_raw_path << "\n";
 
    //
    //  import the python wrapper script as a module
@@ -489,7 +489,7 @@ dataplane_from_numpy_array(np, attrs_dict_obj, met_dp_out, met_grid_out, vinfo);
    //  cleanup
    //
 
-remove_temp_file(tmp_nc_path);
+remove_temp_file(tmp_raw_path);
 
    //
    //  done
@@ -95,6 +95,35 @@ bool MetPointData::get_header(int header_offset, float hdr_arr[HDR_ARRAY_LEN],
    return true;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Same as above but without copying strings.  The message type and
+// station ID are returned as indices into the typ_array and sid_array
+// of the header data and the valid time strings are decoded once.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool MetPointData::get_header(int header_offset, float hdr_arr[HDR_ARRAY_LEN],
+                              int &hdr_typ_idx, int &hdr_sid_idx,
+                              unixtime &hdr_ut) {
+
+   if((int) header_data.vld_ut_array.size() != header_data.vld_array.n()) {
+      header_data.decode_vld_times();
+   }
+
+   hdr_arr[0] = header_data.lat_array[header_offset];
+   hdr_arr[1] = header_data.lon_array[header_offset];
+   hdr_arr[2] = header_data.elv_array[header_offset];
+
+   hdr_typ_idx = use_arr_vars ? header_offset : header_data.typ_idx_array[header_offset];
+   hdr_sid_idx = use_arr_vars ? header_offset : header_data.sid_idx_array[header_offset];
+
+   hdr_ut = header_data.vld_ut_array[use_arr_vars ? header_offset :
+                                     header_data.vld_idx_array[header_offset]];
+
+   return true;
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 bool MetPointData::get_header_type(int header_offset, int hdr_typ_arr[HDR_TYPE_ARR_LEN]) {
@@ -370,6 +399,7 @@ void MetPointHeader::assign(MetPointHeader &h) {
    prpt_typ_array = h.prpt_typ_array;
    irpt_typ_array = h.irpt_typ_array;
    inst_typ_array = h.inst_typ_array;
+   vld_ut_array = h.vld_ut_array;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -390,11 +420,22 @@ void MetPointHeader::clear() {
    prpt_typ_array.clear();
    irpt_typ_array.clear();
    inst_typ_array.clear();
+   vld_ut_array.clear();
 
 }
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void MetPointHeader::decode_vld_times() {
+
+   vld_ut_array.resize(vld_array.n());
+   for(int i=0; i<vld_array.n(); i++) {
+      vld_ut_array[i] = timestring_to_unix(vld_array[i].c_str());
+   }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void MetPointHeader::reset_counters() {
    //valid_point_obs = false;
    typ_len = 0;
@@ -18,6 +18,7 @@
 
 
 #include <ostream>
+#include <vector>
 
 #include "nc_utils.h"
 
@@ -49,9 +50,12 @@ struct MetPointHeader {
    IntArray    irpt_typ_array;
    IntArray    inst_typ_array;
 
+   std::vector<unixtime> vld_ut_array;   // decoded vld_array entries
+
    MetPointHeader();
    void assign(MetPointHeader &h);
    void clear();
+   void decode_vld_times();
    void reset_counters();
 };
 
@@ -112,6 +116,8 @@ class MetPointData {
       bool get_header(int header_offset, float hdr_arr[HDR_ARRAY_LEN],
                       ConcatString &hdr_typ_str, ConcatString &hdr_sid_str,
                       ConcatString &hdr_vld_str);
+      bool get_header(int header_offset, float hdr_arr[HDR_ARRAY_LEN],
+                      int &hdr_typ_idx, int &hdr_sid_idx, unixtime &hdr_ut);
       int get_header_offset(const float obs_arr[OBS_ARRAY_LEN]);
       bool get_header_type(int header_offset, int hdr_typ_arr[HDR_TYPE_ARR_LEN]);
       bool get_lats(float *hdr_lats);
@@ -70,6 +70,7 @@ bool MetNcPointObsIn::read_dim_headers() {
       obs_vars.use_var_id = use_var_id = IS_VALID_NC(obs_vars.obs_vid_var);
       use_arr_vars = IS_VALID_NC(obs_vars.obs_arr_var);
       obs_vars.read_header_data(header_data);
+      header_data.decode_vld_times();
    }
    return status;
 }
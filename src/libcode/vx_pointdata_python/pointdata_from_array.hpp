@@ -34,18 +34,34 @@ int j;
 T * u = (T *) buf;
 T value;
 
-for (j=0; j<n; ++j)  {
+if ( need_swap )  {
 
-   //numpy_array_one_to_two(j, Nx, r, c);
+   for (j=0; j<n; ++j)  {
 
-   memcpy(&value, u + j, sizeof(T));
+      memcpy(&value, u + j, sizeof(T));
 
-   if ( need_swap )  shuf(&value);
+      shuf(&value);
 
-   out[j] = value;
-   
-   mlog << Debug(api_debug_level) << "load_numpy(float): [" << j << "] value=" << value << "\n";
-}   //  for j
+      out[j] = value;
+
+   }   //  for j
+
+}
+else  {
+
+   for (j=0; j<n; ++j)  out[j] = u[j];
+
+}
+
+if ( mlog.verbosity_level() >= api_debug_level )  {
+
+   for (j=0; j<n; ++j)  {
+
+      mlog << Debug(api_debug_level) << "load_numpy(float): [" << j << "] value=" << out[j] << "\n";
+
+   }   //  for j
+
+}
 
 
 return;
@@ -71,18 +87,34 @@ int j;
 T * u = (T *) buf;
 T value;
 
-for (j=0; j<n; ++j)  {
+if ( need_swap )  {
 
-   //numpy_array_one_to_two(j, Nx, r, c);
+   for (j=0; j<n; ++j)  {
 
-   memcpy(&value, u + j, sizeof(T));
+      memcpy(&value, u + j, sizeof(T));
 
-   if ( need_swap )  shuf(&value);
+      shuf(&value);
 
-   out[j] = (int)value;
+      out[j] = (int)value;
 
-   mlog << Debug(api_debug_level) << method_name << "[" << j << "] value=" << value << "\n";
-}   //  for j
+   }   //  for j
+
+}
+else  {
+
+   for (j=0; j<n; ++j)  out[j] = (int)u[j];
+
+}
+
+if ( mlog.verbosity_level() >= api_debug_level )  {
+
+   for (j=0; j<n; ++j)  {
+
+      mlog << Debug(api_debug_level) << method_name << "[" << j << "] value=" << out[j] << "\n";
+
+   }   //  for j
+
+}
 
 
 return;
@@ -103,6 +135,7 @@ void load_numpy_int (void * buf,
 
 const char *method_name = "load_numpy_int(IntArray *) ";
 bool need_swap = (shuf != 0) && (native_endian != data_endian);
+bool do_log = ( mlog.verbosity_level() >= api_debug_level );
 
 int j;
 T * u = (T *) buf;
@@ -112,15 +145,13 @@ out->extend(n);
 
 for (j=0; j<n; ++j)  {
 
-   //numpy_array_one_to_two(j, Nx, r, c);
-
    memcpy(&value, u + j, sizeof(T));
 
    if ( need_swap )  shuf(&value);
 
    out->add((int)value);
 
-   mlog << Debug(api_debug_level) << method_name << " [" << j << "] value=" << value << "\n";
+   if ( do_log )  mlog << Debug(api_debug_level) << method_name << " [" << j << "] value=" << value << "\n";
 }   //  for j
 
 
@@ -143,6 +174,7 @@ void load_numpy_num (void * buf,
 
 const char *method_name = "load_numpy_num(NumArray *) ";
 bool need_swap = (shuf != 0) && (native_endian != data_endian);
+bool do_log = ( mlog.verbosity_level() >= api_debug_level );
 
 int j;
 T * u = (T *) buf;
@@ -152,15 +184,13 @@ out->extend(n);
 
 for (j=0; j<n; ++j)  {
 
-   //numpy_array_one_to_two(j, Nx, r, c);
-
    memcpy(&value, u + j, sizeof(T));
 
    if ( need_swap )  shuf(&value);
 
    out->add((float)value);
 
-   mlog << Debug(api_debug_level) << method_name << "[" << j << "] value=" << value << "\n";
+   if ( do_log )  mlog << Debug(api_debug_level) << method_name << "[" << j << "] value=" << value << "\n";
 }   //  for j
 
 
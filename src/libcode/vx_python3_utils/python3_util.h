@@ -36,6 +36,8 @@ static const char python_dir           [] = "MET_BASE/python";
 
 static const char tmp_nc_base_name     [] = "tmp_met_nc";
 
+static const char tmp_raw_base_name    [] = "tmp_met_raw";
+
 static const char tmp_nc_file_var_name [] = "tmp_nc_filename";
 
 static const char tmp_nc_point_var_name[] = "met_point_data";
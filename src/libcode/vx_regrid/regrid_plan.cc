@@ -0,0 +1,597 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+using namespace std;
+
+#include <iostream>
+#include <fstream>
+#include <map>
+#include <string>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "regrid_plan.h"
+
+#include "vx_log.h"
+#include "nint.h"
+#include "temp_file.h"
+#include "hash_util.h"
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const char regrid_plan_dir_env[] = "MET_REGRID_PLAN_DIR";
+static const char regrid_plan_mb_env[]  = "MET_REGRID_PLAN_MB";
+static const char regrid_plan_magic[]   = "MET_REGRID_PLAN";
+static const int  regrid_plan_version   = 1;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static map<string, RegridPlan> plans;
+
+static long long     plan_bytes     = 0;
+static long long     max_plan_bytes = -1;
+static unsigned long plan_use_count = 0;
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static ConcatString regrid_plan_key   (RegridPlanType, const Grid &, const Grid &);
+static ConcatString grid_fingerprint  (const Grid &);
+static ConcatString regrid_plan_file  (const ConcatString & key);
+
+static void         plan_sizes        (RegridPlanType, const Grid &, const Grid &,
+                                       long long & n_xy, long long & n_iw);
+static long long    estimate_n_bytes  (RegridPlanType, const Grid &, const Grid &);
+
+static void         build_regrid_plan (RegridPlan &, const Grid &, const Grid &);
+
+static bool         read_regrid_plan  (RegridPlan &, const ConcatString & key,
+                                       const Grid &, const Grid &);
+static void         write_regrid_plan (const RegridPlan &, const ConcatString & key);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+long long RegridPlan::n_bytes() const
+
+{
+
+return ( (long long) (X.size() + Y.size() + Weight.size())*sizeof(double) +
+         (long long) Index.size()*sizeof(int) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+const RegridPlan * get_regrid_plan(RegridPlanType type, const Grid & from_grid, const Grid & to_grid)
+
+{
+
+ConcatString cs;
+
+   //
+   //  set the memory ceiling
+   //
+
+if ( max_plan_bytes < 0 )  {
+
+   max_plan_bytes = (long long) default_regrid_plan_mb * 1024 * 1024;
+
+   if ( get_env(regrid_plan_mb_env, cs) && cs.nonempty() )  {
+      max_plan_bytes = (long long) atoi(cs.c_str()) * 1024 * 1024;
+   }
+
+}
+
+long long n_bytes = estimate_n_bytes(type, from_grid, to_grid);
+
+if ( n_bytes > max_plan_bytes )  return ( (const RegridPlan *) 0 );
+
+   //
+   //  check for an existing plan
+   //
+
+ConcatString key = regrid_plan_key(type, from_grid, to_grid);
+
+map<string, RegridPlan>::iterator it = plans.find(key);
+
+if ( it != plans.end() )  {
+
+   it->second.LastUse = ++plan_use_count;
+
+   return ( &(it->second) );
+
+}
+
+   //
+   //  remove the least recently used plans to make room
+   //
+
+while ( !plans.empty() && plan_bytes + n_bytes > max_plan_bytes )  {
+
+   map<string, RegridPlan>::iterator lru = plans.begin();
+
+   for (it=plans.begin(); it!=plans.end(); ++it)  {
+      if ( it->second.LastUse < lru->second.LastUse )  lru = it;
+   }
+
+   plan_bytes -= lru->second.n_bytes();
+
+   plans.erase(lru);
+
+}
+
+   //
+   //  read the plan from a previous run or build it
+   //
+
+RegridPlan & plan = plans[key];
+
+plan.Type = type;
+
+if ( read_regrid_plan(plan, key, from_grid, to_grid) )  {
+
+   mlog << Debug(4) << "get_regrid_plan() -> "
+        << "read regridding plan from \"" << regrid_plan_file(key) << "\".\n";
+
+} else {
+
+   build_regrid_plan(plan, from_grid, to_grid);
+
+   write_regrid_plan(plan, key);
+
+}
+
+plan.LastUse = ++plan_use_count;
+
+plan_bytes += plan.n_bytes();
+
+return ( &plan );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void budget_sub_sample_xy(const Grid & from_grid, const Grid & to_grid,
+                          int xt, int yt, double * x_from, double * y_from)
+
+{
+
+int i, j, k;
+double dxt, dyt, lat, lon;
+const double delta = 1.0/budget_regrid_n;
+
+for (i=-budget_regrid_radius, k=0; i<=budget_regrid_radius; ++i)  {
+
+   dxt = xt + i*delta;
+
+   for (j=-budget_regrid_radius; j<=budget_regrid_radius; ++j, ++k)  {
+
+      dyt = yt + j*delta;
+
+      to_grid.xy_to_latlon(dxt, dyt, lat, lon);
+
+      from_grid.latlon_to_xy(lat, lon, x_from[k], y_from[k]);
+
+   }   //  for j
+
+}   //  for i
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  number of X and Y entries (n_xy) and of Index and Weight
+   //  entries (n_iw) in a plan of this type
+   //
+
+void plan_sizes(RegridPlanType type, const Grid & from_grid, const Grid & to_grid,
+                long long & n_xy, long long & n_iw)
+
+{
+
+long long n_to   = (long long) to_grid.nx()*to_grid.ny();
+long long n_from = (long long) from_grid.nx()*from_grid.ny();
+
+n_xy = n_iw = 0;
+
+switch ( type )  {
+
+   case RegridPlan_Point:
+      n_xy = n_to;
+      break;
+
+   case RegridPlan_Budget:
+      n_xy = n_to*budget_regrid_n*budget_regrid_n;
+      break;
+
+   case RegridPlan_AreaWeighted:
+      n_iw = n_from;
+      break;
+
+}   //  switch type
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+long long estimate_n_bytes(RegridPlanType type, const Grid & from_grid, const Grid & to_grid)
+
+{
+
+long long n_xy, n_iw;
+
+plan_sizes(type, from_grid, to_grid, n_xy, n_iw);
+
+return ( n_xy*2*sizeof(double) + n_iw*(sizeof(int) + sizeof(double)) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void build_regrid_plan(RegridPlan & plan, const Grid & from_grid, const Grid & to_grid)
+
+{
+
+int xt, yt, xf, yf, n;
+double lat, lon, x, y;
+const int nn = budget_regrid_n*budget_regrid_n;
+
+plan.X.clear();
+plan.Y.clear();
+plan.Index.clear();
+plan.Weight.clear();
+
+switch ( plan.Type )  {
+
+   case RegridPlan_Point:
+
+      plan.X.resize(to_grid.nx()*to_grid.ny());
+      plan.Y.resize(to_grid.nx()*to_grid.ny());
+
+      for (xt=0, n=0; xt<(to_grid.nx()); ++xt)  {
+         for (yt=0; yt<(to_grid.ny()); ++yt, ++n)  {
+            to_grid.xy_to_latlon(xt, yt, lat, lon);
+            from_grid.latlon_to_xy(lat, lon, plan.X[n], plan.Y[n]);
+         }
+      }
+      break;
+
+   case RegridPlan_Budget:
+
+      plan.X.resize(to_grid.nx()*to_grid.ny()*nn);
+      plan.Y.resize(to_grid.nx()*to_grid.ny()*nn);
+
+      for (xt=0, n=0; xt<(to_grid.nx()); ++xt)  {
+         for (yt=0; yt<(to_grid.ny()); ++yt, n+=nn)  {
+            budget_sub_sample_xy(from_grid, to_grid, xt, yt,
+                                 &plan.X[n], &plan.Y[n]);
+         }
+      }
+      break;
+
+   case RegridPlan_AreaWeighted:
+
+      plan.Index.resize(from_grid.nx()*from_grid.ny());
+      plan.Weight.resize(from_grid.nx()*from_grid.ny());
+
+      for (xf=0, n=0; xf<(from_grid.nx()); ++xf)  {
+         for (yf=0; yf<(from_grid.ny()); ++yf, ++n)  {
+
+            from_grid.xy_to_latlon(xf, yf, lat, lon);
+            to_grid.latlon_to_xy(lat, lon, x, y);
+
+            xt = nint(x);
+            yt = nint(y);
+
+            if ( (xt < 0) || (xt >= to_grid.nx()) || (yt < 0) || (yt >= to_grid.ny()) )  {
+               plan.Index[n]  = -1;
+               plan.Weight[n] = 0.0;
+            } else {
+               plan.Index[n]  = xt*to_grid.ny() + yt;
+               plan.Weight[n] = from_grid.calc_area(xf, yf);
+            }
+
+         }
+      }
+      break;
+
+}   //  switch plan.Type
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//
+//  The serialized grids only retain a few decimal places, so the
+//  exact locations of some of the grid points are included as well.
+//
+////////////////////////////////////////////////////////////////////////
+
+
+ConcatString grid_fingerprint(const Grid & g)
+
+{
+
+ConcatString cs;
+char junk[256];
+double lat, lon;
+int i, x, y;
+const int nx = g.nx();
+const int ny = g.ny();
+const int xs[] = { 0, nx - 1, 0,      nx - 1, nx/2, nx/3, (2*nx)/3 };
+const int ys[] = { 0, 0,      ny - 1, ny - 1, ny/2, ny/7, (5*ny)/7 };
+
+cs = g.serialize();
+
+for (i=0; i<(int) (sizeof(xs)/sizeof(*xs)); ++i)  {
+
+   x = xs[i];
+   y = ys[i];
+
+   g.xy_to_latlon(x, y, lat, lon);
+
+   snprintf(junk, sizeof(junk), " (%d,%d)->(%.10f,%.10f)", x, y, lat, lon);
+
+   cs << junk;
+
+}
+
+return ( cs );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ConcatString regrid_plan_key(RegridPlanType type, const Grid & from_grid, const Grid & to_grid)
+
+{
+
+ConcatString key;
+
+key << "type " << (int) type
+    << " from " << grid_fingerprint(from_grid)
+    << " to "   << grid_fingerprint(to_grid);
+
+return ( key );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+ConcatString regrid_plan_file(const ConcatString & key)
+
+{
+
+ConcatString dir, path;
+
+if ( !get_env(regrid_plan_dir_env, dir) || dir.empty() )  return ( path );
+
+path.format("%s/regrid_plan_%016llx.bin", dir.c_str(), fnv1a_hash(key.c_str()));
+
+return ( path );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+template <typename T>
+static void write_plan_vector(ofstream & out, const vector<T> & v)
+
+{
+
+long long n = v.size();
+
+out.write((const char *) &n, sizeof(n));
+
+if ( n > 0 )  out.write((const char *) v.data(), n*sizeof(T));
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+template <typename T>
+static bool read_plan_vector(ifstream & in, vector<T> & v, long long expected_n)
+
+{
+
+long long n = 0;
+
+in.read((char *) &n, sizeof(n));
+
+if ( !in || n != expected_n )  return ( false );
+
+v.resize(n);
+
+if ( n > 0 )  in.read((char *) v.data(), n*sizeof(T));
+
+return ( (bool) in );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  a plan file that doesn't match the grids in every respect is
+   //  ignored, so that the plan is rebuilt rather than used
+   //
+
+bool read_regrid_plan(RegridPlan & plan, const ConcatString & key,
+                      const Grid & from_grid, const Grid & to_grid)
+
+{
+
+ConcatString path = regrid_plan_file(key);
+
+if ( path.empty() )  return ( false );
+
+ifstream in(path.c_str(), ios::in | ios::binary);
+
+if ( !in )  return ( false );
+
+char magic[sizeof(regrid_plan_magic)];
+int version = 0, type = 0, n_key = 0;
+
+in.read(magic, sizeof(magic));
+in.read((char *) &version, sizeof(version));
+in.read((char *) &type,    sizeof(type));
+in.read((char *) &n_key,   sizeof(n_key));
+
+if ( !in || strncmp(magic, regrid_plan_magic, sizeof(magic)) != 0 ||
+     version != regrid_plan_version || type != (int) plan.Type ||
+     n_key != (int) key.length() )  return ( false );
+
+vector<char> key_buf(n_key);
+
+if ( n_key > 0 )  in.read(key_buf.data(), n_key);
+
+if ( !in || key != string(key_buf.begin(), key_buf.end()) )  return ( false );
+
+   //
+   //  the vector lengths must match the grid dimensions and the
+   //  to_grid indices must be in range
+   //
+
+long long n_xy, n_iw;
+
+plan_sizes(plan.Type, from_grid, to_grid, n_xy, n_iw);
+
+bool status = ( read_plan_vector(in, plan.X,      n_xy) &&
+                read_plan_vector(in, plan.Y,      n_xy) &&
+                read_plan_vector(in, plan.Index,  n_iw) &&
+                read_plan_vector(in, plan.Weight, n_iw) );
+
+const long long n_to = (long long) to_grid.nx()*to_grid.ny();
+
+for (unsigned int i=0; status && i<plan.Index.size(); ++i)  {
+
+   if ( plan.Index[i] < -1 || plan.Index[i] >= n_to )  status = false;
+
+}
+
+if ( !status )  {
+
+   mlog << Debug(3) << "read_regrid_plan() -> "
+        << "ignoring regridding plan file \"" << path
+        << "\" which does not match the grids.\n";
+
+   plan.X.clear();
+   plan.Y.clear();
+   plan.Index.clear();
+   plan.Weight.clear();
+
+   return ( false );
+
+}
+
+return ( true );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void write_regrid_plan(const RegridPlan & plan, const ConcatString & key)
+
+{
+
+ConcatString path = regrid_plan_file(key);
+
+if ( path.empty() )  return;
+
+ConcatString tmp_path = make_temp_file_name(path.c_str(), nullptr);
+
+ofstream out(tmp_path.c_str(), ios::out | ios::binary);
+
+if ( !out )  {
+
+   mlog << Debug(3) << "write_regrid_plan() -> "
+        << "unable to write regridding plan file \"" << path << "\".\n";
+
+   return;
+
+}
+
+int type  = (int) plan.Type;
+int n_key = key.length();
+
+out.write(regrid_plan_magic, sizeof(regrid_plan_magic));
+out.write((const char *) &regrid_plan_version, sizeof(regrid_plan_version));
+out.write((const char *) &type,  sizeof(type));
+out.write((const char *) &n_key, sizeof(n_key));
+out.write(key.c_str(), n_key);
+
+write_plan_vector(out, plan.X);
+write_plan_vector(out, plan.Y);
+write_plan_vector(out, plan.Index);
+write_plan_vector(out, plan.Weight);
+
+out.close();
+
+if ( !out || rename(tmp_path.c_str(), path.c_str()) != 0 )  {
+
+   mlog << Debug(3) << "write_regrid_plan() -> "
+        << "unable to write regridding plan file \"" << path << "\".\n";
+
+   remove(tmp_path.c_str());
+
+   return;
+
+}
+
+mlog << Debug(4) << "write_regrid_plan() -> "
+     << "wrote regridding plan file \"" << path << "\".\n";
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,107 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#ifndef  __MET_REGRID_PLAN_H__
+#define  __MET_REGRID_PLAN_H__
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#include <vector>
+
+#include "vx_grid.h"
+
+
+////////////////////////////////////////////////////////////////////////
+//
+//  The projections between a pair of grids are the same for every
+//  field regridded between them, so they are computed once and stored
+//  in a plan which is reused for later fields.
+//
+//  Plans are kept in memory, up to MET_REGRID_PLAN_MB megabytes
+//  (0 disables them), and if MET_REGRID_PLAN_DIR is set they are also
+//  written to that directory for reuse in later runs.
+//
+////////////////////////////////////////////////////////////////////////
+
+
+enum RegridPlanType {
+
+   RegridPlan_Point,         //  from_grid location of each to_grid point
+   RegridPlan_Budget,        //  from_grid location of each to_grid sub-sample
+   RegridPlan_AreaWeighted   //  to_grid point and area of each from_grid point
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+static const int budget_regrid_radius   = 2;
+static const int budget_regrid_n        = 2*budget_regrid_radius + 1;
+
+static const int default_regrid_plan_mb = 1024;
+
+
+////////////////////////////////////////////////////////////////////////
+//
+//  Points are ordered with y varying fastest, n = x*ny + y.
+//
+//  RegridPlan_Point        : X, Y for each to_grid point
+//  RegridPlan_Budget       : X, Y for each of the budget_regrid_n^2
+//                            sub-samples of each to_grid point
+//  RegridPlan_AreaWeighted : Index (-1 if outside) and Weight for
+//                            each from_grid point
+//
+////////////////////////////////////////////////////////////////////////
+
+
+struct RegridPlan {
+
+   RegridPlanType Type;
+
+   std::vector<double> X;
+   std::vector<double> Y;
+
+   std::vector<int>    Index;
+   std::vector<double> Weight;
+
+   unsigned long LastUse;
+
+   long long n_bytes() const;
+
+};
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+   //
+   //  returns 0 if the plan would exceed the memory ceiling,
+   //  otherwise the plan is valid until the next call
+   //
+
+extern const RegridPlan * get_regrid_plan (RegridPlanType, const Grid & from_grid, const Grid & to_grid);
+
+extern void budget_sub_sample_xy (const Grid & from_grid, const Grid & to_grid,
+                                  int xt, int yt, double * x_from, double * y_from);
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+#endif   /*  __MET_REGRID_PLAN_H__  */
+
+
+////////////////////////////////////////////////////////////////////////
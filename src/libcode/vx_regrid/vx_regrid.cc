@@ -14,6 +14,7 @@
 using namespace std;
 
 #include "vx_regrid.h"
+#include "regrid_plan.h"
 
 #include "interp_mthd.h"
 
@@ -113,11 +114,12 @@ DataPlane met_regrid_generic (const DataPlane & from_data, const Grid & from_gri
 
 {
 
-int xt, yt;
+int xt, yt, n;
 int xf, yf;
 double value, lat, lon;
 double x_from, y_from;
 DataPlane to_data;
+const RegridPlan * plan = get_regrid_plan(RegridPlan_Point, from_grid, to_grid);
 
 to_data.set_size(to_grid.nx(), to_grid.ny());
 
@@ -134,13 +136,17 @@ to_data.set_accum (from_data.accum());
    //  copy data
    //
 
-for (xt=0; xt<(to_grid.nx()); ++xt)  {
-
-   for (yt=0; yt<(to_grid.ny()); ++yt)  {
+for (xt=0, n=0; xt<(to_grid.nx()); ++xt)  {
 
-      to_grid.xy_to_latlon(xt, yt, lat, lon);
+   for (yt=0; yt<(to_grid.ny()); ++yt, ++n)  {
 
-      from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+      if ( plan )  {
+         x_from = plan->X[n];
+         y_from = plan->Y[n];
+      } else {
+         to_grid.xy_to_latlon(xt, yt, lat, lon);
+         from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+      }
 
       xf = nint(x_from);
       yf = nint(y_from);
@@ -177,11 +183,12 @@ DataPlane met_regrid_area_weighted (const DataPlane & from_data, const Grid & fr
 
 {
 
-int xt, yt;
+int xt, yt, n;
 int xf, yf;
 double value, weight, lat, lon;
 double x_to, y_to;
 DataPlane to_data, wt_data;
+const RegridPlan * plan = get_regrid_plan(RegridPlan_AreaWeighted, from_grid, to_grid);
 
    //
    //  The interpolation width and shape do not apply here.  The output
@@ -213,16 +220,20 @@ to_data.set_accum (from_data.accum());
    //  loop over the from grid to accumulate sums and area weights
    //
 
-for (xf=0; xf<(from_grid.nx()); ++xf)  {
-
-   for (yf=0; yf<(from_grid.ny()); ++yf)  {
-
-      from_grid.xy_to_latlon(xf, yf, lat, lon);
+for (xf=0, n=0; xf<(from_grid.nx()); ++xf)  {
 
-      to_grid.latlon_to_xy(lat, lon, x_to, y_to);
+   for (yf=0; yf<(from_grid.ny()); ++yf, ++n)  {
 
-      xt = nint(x_to);
-      yt = nint(y_to);
+      if ( plan )  {
+         if ( plan->Index[n] < 0 )  continue;
+         xt = plan->Index[n] / to_grid.ny();
+         yt = plan->Index[n] % to_grid.ny();
+      } else {
+         from_grid.xy_to_latlon(xf, yf, lat, lon);
+         to_grid.latlon_to_xy(lat, lon, x_to, y_to);
+         xt = nint(x_to);
+         yt = nint(y_to);
+      }
 
       if ( (xt < 0) || (xt >= to_grid.nx()) || (yt < 0) || (yt >= to_grid.ny()) )  {
 
@@ -231,7 +242,7 @@ for (xf=0; xf<(from_grid.nx()); ++xf)  {
       } else {
 
          if ( is_bad_data(value = from_data(xf, yf)) )  continue;
-         weight = from_grid.calc_area(xf, yf);
+         weight = ( plan ? plan->Weight[n] : from_grid.calc_area(xf, yf) );
 
          to_data.set(to_data(xt, yt) + value*weight, xt, yt);
          wt_data.set(wt_data(xt, yt) + weight,       xt, yt);
@@ -308,11 +319,12 @@ DataPlane met_regrid_maxgauss (const DataPlane & from_data, const Grid & from_gr
 
 {
 
-int xt, yt;
+int xt, yt, n;
 int xf, yf;
 double value, lat, lon;
 double x_from, y_from;
 DataPlane to_data;
+const RegridPlan * plan = get_regrid_plan(RegridPlan_Point, from_grid, to_grid);
 
 to_data.set_size(to_grid.nx(), to_grid.ny());
 
@@ -329,13 +341,17 @@ to_data.set_accum (from_data.accum());
    //  copy data
    //
 
-for (xt=0; xt<(to_grid.nx()); ++xt)  {
+for (xt=0, n=0; xt<(to_grid.nx()); ++xt)  {
 
-   for (yt=0; yt<(to_grid.ny()); ++yt)  {
+   for (yt=0; yt<(to_grid.ny()); ++yt, ++n)  {
 
-      to_grid.xy_to_latlon(xt, yt, lat, lon);
-
-      from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+      if ( plan )  {
+         x_from = plan->X[n];
+         y_from = plan->Y[n];
+      } else {
+         to_grid.xy_to_latlon(xt, yt, lat, lon);
+         from_grid.latlon_to_xy(lat, lon, x_from, y_from);
+      }
 
       xf = nint(x_from);
       yf = nint(y_from);
@@ -14,6 +14,7 @@
 using namespace std;
 
 #include "vx_regrid.h"
+#include "regrid_plan.h"
 
 #include "interp_mthd.h"
 
@@ -26,21 +27,22 @@ DataPlane met_regrid_budget (const DataPlane & from_data, const Grid & from_grid
 {
 
 DataPlane to_data;
-int i, j, ixt, iyt;
+int ixt, iyt, k, n;
 int count;
-double dxt, dyt, dxf, dyf;
-double sum, lat, lon, value;
+double sum, value;
 double fraction;
+double dxf[budget_regrid_n*budget_regrid_n];
+double dyf[budget_regrid_n*budget_regrid_n];
+const double *x_from = dxf, *y_from = dyf;
 
    //
-   //  Hard-code the radius for budget interpolation.
+   //  The radius for budget interpolation is hard-coded.
    //  Consider making this configurable.
    //
 
-const int Radius = 2;
-const int N = 2*Radius + 1;
-const int NN = N*N;
-const double delta = 1.0/N;
+const int NN = budget_regrid_n*budget_regrid_n;
+
+const RegridPlan * plan = get_regrid_plan(RegridPlan_Budget, from_grid, to_grid);
 
 to_data.set_size(to_grid.nx(), to_grid.ny());
 
@@ -57,33 +59,28 @@ to_data.set_accum (from_data.accum());
    //  Do the interpolation
    //
 
-for (ixt=0; ixt<(to_grid.nx()); ++ixt)  {
+for (ixt=0, n=0; ixt<(to_grid.nx()); ++ixt)  {
+
+   for (iyt=0; iyt<(to_grid.ny()); ++iyt, n+=NN)  {
 
-   for (iyt=0; iyt<(to_grid.ny()); ++iyt)  {
+      if ( plan )  {
+         x_from = &(plan->X[n]);
+         y_from = &(plan->Y[n]);
+      } else {
+         budget_sub_sample_xy(from_grid, to_grid, ixt, iyt, dxf, dyf);
+      }
 
       sum = 0.0;
 
       count = 0;
 
-      for (i=-Radius; i<=Radius; ++i)  {
-
-         dxt = ixt + i*delta;
-
-         for (j=-Radius; j<=Radius; ++j)  {
-
-            dyt = iyt + j*delta;
-
-            to_grid.xy_to_latlon(dxt, dyt, lat, lon);
-
-            from_grid.latlon_to_xy(lat, lon, dxf, dyf);
-
-            value = interp_bilin(from_data, from_grid.wrap_lon(), dxf, dyf);
+      for (k=0; k<NN; ++k)  {
 
-            if ( value != bad_data_double )  { sum += value;  ++count; }
+         value = interp_bilin(from_data, from_grid.wrap_lon(), x_from[k], y_from[k]);
 
-         }   //  for j
+         if ( value != bad_data_double )  { sum += value;  ++count; }
 
-      }   //  for i
+      }   //  for k
 
       fraction = ((double) count)/((double) NN);
 
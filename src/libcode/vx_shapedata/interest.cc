@@ -93,6 +93,7 @@ void SingleFeature::init_from_scratch()
 {
 
 boundary = (Polyline *) 0;
+bdy_box  = (Box *) 0;
 
 clear();
 
@@ -136,8 +137,13 @@ void SingleFeature::clear()
    // Deallocate memory
    //
    if(boundary) { delete [] boundary;  boundary = (Polyline *) 0; }
+   if(bdy_box)  { delete [] bdy_box;   bdy_box  = (Box *) 0;      }
    n_bdy = 0;
 
+   n_on  = 0;
+   x_min = y_min = 0;
+   x_max = y_max = -1;
+
    return;
 }
 
@@ -183,7 +189,17 @@ void SingleFeature::assign(const SingleFeature & s)
    //
    n_bdy    = s.n_bdy;
    boundary = new Polyline [n_bdy];
-   for(i=0; i<n_bdy; i++) boundary[i] = s.boundary[i];
+   bdy_box  = new Box      [n_bdy];
+   for(i=0; i<n_bdy; i++) {
+      boundary[i] = s.boundary[i];
+      bdy_box[i]  = s.bdy_box[i];
+   }
+
+   n_on  = s.n_on;
+   x_min = s.x_min;
+   x_max = s.x_max;
+   y_min = s.y_min;
+   y_max = s.y_max;
 
    return;
 }
@@ -196,7 +212,7 @@ void SingleFeature::set(const ShapeData &raw, const ShapeData &thresh,
 
 {
 
-   int i;
+   int i, x, y;
    ShapeData split_wd, obj_wd;
 
    clear();
@@ -267,9 +283,28 @@ void SingleFeature::set(const ShapeData &raw, const ShapeData &thresh,
    //
    split_wd = split(mask, n_bdy);
    boundary = new Polyline [n_bdy];
+   bdy_box  = new Box      [n_bdy];
    for(i=0; i<n_bdy; i++) {
       obj_wd      = select(split_wd, i+1);
       boundary[i] = obj_wd.single_boundary();
+      if(boundary[i].n_points > 0) boundary[i].bounding_box(bdy_box[i]);
+   }
+
+   //
+   // Number and bounding box of the mask points which are on,
+   // used to limit the pair intersection to the overlapping boxes
+   //
+   x_min = Mask->data.nx();
+   y_min = Mask->data.ny();
+   for(x=0; x<Mask->data.nx(); x++) {
+      for(y=0; y<Mask->data.ny(); y++) {
+         if(!Mask->s_is_on(x, y)) continue;
+         n_on++;
+         if(x < x_min) x_min = x;
+         if(x > x_max) x_max = x;
+         if(y < y_min) y_min = y;
+         if(y > y_max) y_max = y;
+      }
    }
 
    //
@@ -279,6 +314,22 @@ void SingleFeature::set(const ShapeData &raw, const ShapeData &thresh,
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Lower bound on the distance between anything inside two boxes
+//
+////////////////////////////////////////////////////////////////////////
+
+static double box_dist(const Box &a, const Box &b)
+
+{
+
+   double dx = max(0.0, max(a.left()   - b.right(), b.left()   - a.right()));
+   double dy = max(0.0, max(a.bottom() - b.top(),   b.bottom() - a.top()));
+
+   return(sqrt(dx*dx + dy*dy));
+}
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Code for class PairFeature
@@ -426,9 +477,15 @@ void PairFeature::set(const SingleFeature &fcst,
    // Compute it as the minimum distance between any two pairs of
    // polylines.
    //
+   // Skip pairs whose bounding boxes are farther apart than the
+   // minimum found so far, since they cannot change it.
+   //
    boundary_dist = 1.0e30;
    for(i=0; i<Obs->n_bdy; i++) {
       for(j=0; j<Fcst->n_bdy; j++) {
+         if(Obs->boundary[i].n_points  > 0 &&
+            Fcst->boundary[j].n_points > 0 &&
+            box_dist(Obs->bdy_box[i], Fcst->bdy_box[j]) >= boundary_dist) continue;
          d = polyline_dist(Obs->boundary[i], Fcst->boundary[j]);
          if(d < boundary_dist) boundary_dist = d;
          if(is_eq(boundary_dist, 0.0)) break;
@@ -465,20 +522,21 @@ void PairFeature::set(const SingleFeature &fcst,
    //
    // Intersection, union, and symmetric diff areas
    //
-   intersection_area = union_area = 0.0;
-   symmetric_diff = 0.0;
-   for(x=0; x<(Fcst->Mask->data.nx()); ++x) {
-      for(y=0; y<(Fcst->Mask->data.ny()); ++y) {
+   // Only the overlap of the bounding boxes can intersect, and the
+   // union and symmetric difference follow from the object counts.
+   //
+   intersection_area = 0.0;
+   for(x=max(Fcst->x_min, Obs->x_min); x<=min(Fcst->x_max, Obs->x_max); ++x) {
+      for(y=max(Fcst->y_min, Obs->y_min); y<=min(Fcst->y_max, Obs->y_max); ++y) {
 
          fcst_on = Fcst->Mask->s_is_on(x, y);
          obs_on  =  Obs->Mask->s_is_on(x, y);
 
          if(fcst_on && obs_on) intersection_area++;
-         if(fcst_on || obs_on) union_area++;
-         if((fcst_on && !obs_on) ||
-            (!fcst_on && obs_on)) symmetric_diff++;
       }
    }
+   union_area     = Fcst->n_on + Obs->n_on - intersection_area;
+   symmetric_diff = union_area - intersection_area;
 
    //
    // Intersection over area
@@ -80,7 +80,15 @@ class SingleFeature {
 
       Polyline  convex_hull;
       Polyline *boundary;   //  allocated
+      Box      *bdy_box;    //  allocated, bounding box of each boundary
       int       n_bdy;
+
+      //
+      // number and bounding box of the mask points which are on
+      //
+      int n_on;
+      int x_min, x_max;
+      int y_min, y_max;
 };
 
 ////////////////////////////////////////////////////////////////////////
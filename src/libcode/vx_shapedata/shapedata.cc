@@ -518,17 +518,11 @@ void ShapeData::conv_filter_circ(int diameter, double vld_thresh)
 
 {
 
-int x, y, xx, yy, u, v;
-int dn, fn, nn;
-int vpr, upr;
-int count, bd_count;
-double center, cur, sum;
-double dx, dy, dist;
-double vld_ratio;
+int x, y, u, v;
+double dist;
 const int nx = data.nx();
 const int ny = data.ny();
-bool * f = (bool *) 0;
-bool center_bad = false;
+const int nx1 = nx + 1;
 DataPlane in_data = data;
 const bool vld_thresh_one = is_eq(vld_thresh, 1.0);
 
@@ -548,25 +542,51 @@ const int radius = (diameter - 1)/2;
 const vector<double> * in  = &(in_data.Data);
       vector<double> * out = &(data.Data);
 
-f = new bool [diameter*diameter];
+   //
+   //  set up the filter: in each row v of the filter, the cells within
+   //  the radius are a single span of columns -w[v] <= u <= w[v]
+   //
+
+vector<int> w(diameter);
+
+for (v=-radius; v<=radius; ++v)  {
+
+   for (u=radius; u>0; --u)  {
+
+      dist = sqrt( (double) (u*u) + (double) (v*v) );
+
+      if ( dist <= radius )  break;
+
+   }
+
+   w[v + radius] = u;
+
+}
 
    //
-   //  set up the filter
+   //  prefix sums of the valid data values and counts along each row,
+   //  so the sum over a span of columns is a difference of two entries
    //
 
-for (y=0; y<diameter; ++y)  {
+vector<long double> row_sum (nx1*ny, 0.0);
+vector<int>         row_vld (nx1*ny, 0);
 
-   dy = y - radius;
+#pragma omp parallel for default(shared) private(x, y) schedule (static)
+for(y=0; y<ny; y++) {
 
-   for (x=0; x<diameter; ++x)  {
+   int n = y*nx1;
 
-      dx = x - radius;
+   for(x=0; x<nx; x++, n++) {
 
-      dist = sqrt( dx*dx + dy*dy );
+      row_sum[n + 1] = row_sum[n];
+      row_vld[n + 1] = row_vld[n];
 
-      fn = STANDARD_XY_YO_N(diameter, x, y) ;
+      const double cur = (*in)[STANDARD_XY_YO_N(nx, x, y)];
 
-      f[fn] = (dist <= radius);
+      if ( ::is_bad_data(cur) )  continue;
+
+      row_sum[n + 1] += cur;
+      row_vld[n + 1]++;
 
    }
 
@@ -576,13 +596,12 @@ for (y=0; y<diameter; ++y)  {
    //  do the convolution
    //
 
-dn = -1;
-
+#pragma omp parallel for default(shared) private(x, y, u, v) schedule (static)
 for(y=0; y<ny; y++) {
 
    for(x=0; x<nx; x++) {
 
-      ++dn;
+      const int dn = STANDARD_XY_YO_N(nx, x, y);
 
          //
          // If the bad data threshold is set to zero and the center of the
@@ -590,49 +609,31 @@ for(y=0; y<ny; y++) {
          // bad data and continue.
          //
 
-      center = (*in)[dn];
-
-      center_bad = ::is_bad_data(center);
+      const bool center_bad = ::is_bad_data((*in)[dn]);
 
       if ( center_bad && vld_thresh_one ) { (*out)[dn] = bad_data_double;  continue; }
 
-      sum      = 0.0;
-      count    = 0;
-      bd_count = 0;
+      long double sum = 0.0;
+      int count    = 0;
+      int bd_count = 0;
 
       for (v=-radius; v<=radius; ++v) {
 
-         yy = y + v;
+         const int yy = y + v;
 
          if ( (yy < 0) || (yy >= ny) )  continue;
 
-         vpr = v + radius;
-
-         for(u=-radius; u<=radius; ++u) {
-
-            xx = x + u;
-
-            if ( (xx < 0) || (xx >= nx) )  continue;
-
-            upr = u + radius;
-
-            fn = STANDARD_XY_YO_N(diameter, upr, vpr);
-
-            if ( !(f[fn]) )  continue;
-
-            nn = STANDARD_XY_YO_N(nx, xx, yy) ;
-
-            cur = (*in)[nn];
-
-            if( ::is_bad_data(cur) ) { bd_count++;  continue; }
+         const int lo = max(x - w[v + radius], 0);
+         const int hi = min(x + w[v + radius], nx - 1);
+         const int n  = yy*nx1;
 
-            sum += cur;
+         u = row_vld[n + hi + 1] - row_vld[n + lo];
 
-            count++;
+         sum      += row_sum[n + hi + 1] - row_sum[n + lo];
+         count    += u;
+         bd_count += (hi - lo + 1) - u;
 
-         } // for v
-
-      } // for u
+      } // for v
 
          //
          //  If the center of the convolution contains bad data and the ratio
@@ -640,28 +641,28 @@ for(y=0; y<ny; y++) {
          //  value to bad data.
          //
 
-      if ( count == 0 )  sum = bad_data_double;
+      double value;
+
+      if ( count == 0 )  value = bad_data_double;
       else {
 
-         vld_ratio = ((double) count)/(bd_count + count);
+         const double vld_ratio = ((double) count)/(bd_count + count);
 
-         if ( center_bad && (vld_ratio < vld_thresh) )  sum = bad_data_double;
-         else                                           sum /= count;
+         if ( center_bad && (vld_ratio < vld_thresh) )  value = bad_data_double;
+         else                                           value = (double) (sum/count);
 
       }
 
-      (*out)[dn] = sum;
+      (*out)[dn] = value;
 
-   } // for y
+   } // for x
 
-} // for x
+} // for y
 
    //
    //  done
    //
 
-if ( f )  { delete [] f;   f = (bool *) 0; }
-
 return;
 
 }
@@ -1932,29 +1933,25 @@ int ShapeData::n_objects() const
 ///////////////////////////////////////////////////////////////////////////////
 
 void ShapeData::threshold(SingleThresh t) {
-   int j, x, y;
-   double v;
-   const int nx = data.nx();
-   const int ny = data.ny();
+   int i;
+   double *v = data.buf().data();
+   const int nxy = data.nx()*data.ny();
+
+   if(nxy == 0) return;
 
    //
    // Compare the threshold double value to the double values for the
    // ShapeData field
    //
-   for(x=0; x<nx; x++) {
-      for(y=0; y<ny; y++) {
+   bool *tf = new bool [nxy];
 
-         v = data(x, y);
+   t.check(v, nullptr, nullptr, nxy, tf);
 
-         if(t.check(v) && ! ::is_bad_data(v)) {
-            j = 1;
-         }
-         else {
-            j = 0;
-         }
-         data.set((double) j, x, y);
-      } // end for y
-   } // end for x
+   for(i=0; i<nxy; i++) {
+      v[i] = (tf[i] && ! ::is_bad_data(v[i]) ? 1.0 : 0.0);
+   }
+
+   if(tf) { delete [] tf; tf = (bool *) 0; }
 
    return;
 }
@@ -13,12 +13,12 @@ using namespace std;
 
 #include <cstdio>
 #include <errno.h>
-#include <fstream>
 #include <iostream>
 #include <unistd.h>
 #include <stdlib.h>
 #include <string.h>
 #include <cmath>
+#include <vector>
 
 #include "compute_ci.h"
 #include "compute_stats.h"
@@ -29,12 +29,69 @@ using namespace std;
 #include "vx_log.h"
 
 ////////////////////////////////////////////////////////////////////////
+//
+// Number of bootstrap statistics stored for each line type.
+//
+////////////////////////////////////////////////////////////////////////
+
+static const int n_cnt_boot    = 26;
+static const int n_cts_boot    = 21;
+static const int n_mcts_boot   = 5;
+static const int n_nbrcnt_boot = 6;
+
+////////////////////////////////////////////////////////////////////////
+//
+// In-memory storage for bootstrap statistics.  Each statistic is
+// stored in its own contiguous column with one row per jackknife
+// sample or bootstrap replicate.  Rows are preallocated so that
+// replicates computed on different threads can be stored without
+// locking.
+//
+////////////////////////////////////////////////////////////////////////
+
+class BootStatTable {
+
+   private:
+
+      int Nrows;
+      int Ncols;
+
+      vector<double> Data;
+
+   public:
+
+      BootStatTable();
+     ~BootStatTable();
+
+      void set_size(int n_rows, int n_cols);
 
-static void write_cntinfo(ofstream &, const CNTInfo &);
-static void write_ctsinfo(ofstream &, const CTSInfo &);
-static void write_mctsinfo(ofstream &, const MCTSInfo &);
-static void write_nbrcntinfo(ofstream &, const NBRCNTInfo &);
-static void read_ldf(const ConcatString, int, NumArray &);
+      int n_rows() const;
+      int n_cols() const;
+
+      void set(int row, int col, double v);
+
+      void get_col(int col, NumArray &) const;
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline int BootStatTable::n_rows() const { return(Nrows); }
+inline int BootStatTable::n_cols() const { return(Ncols); }
+
+inline void BootStatTable::set(int row, int col, double v) {
+   Data[col*Nrows + row] = v;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static void write_cntinfo(BootStatTable &, int, const CNTInfo &);
+static void write_ctsinfo(BootStatTable &, int, const CTSInfo &);
+static void write_mctsinfo(BootStatTable &, int, const MCTSInfo &);
+static void write_nbrcntinfo(BootStatTable &, int, const NBRCNTInfo &);
+
+static void draw_rep_seeds(const gsl_rng *, int, vector<unsigned long> &);
+static void ran_sample_rep(gsl_rng *, unsigned long,
+                           NumArray &, NumArray &, int);
 
 ////////////////////////////////////////////////////////////////////////
 //
@@ -277,21 +334,19 @@ void compute_hk_ci(double hk, double alpha, double vif,
 void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
                               const PairDataPoint &pd,
                               int b, CTSInfo *&cts_info, int n_cts,
-                              bool cts_flag, bool rank_flag,
-                              const char *tmp_dir) {
+                              bool cts_flag, bool rank_flag) {
    int n = 0;
    int i, j, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
+   NumArray i_na, si_na, sr_na;
    CTSInfo *cts_tmp = (CTSInfo *) 0;
 
    //
-   // Temp file streams for categorical statistics
+   // Bootstrap statistics for each threshold
    //
-   ofstream *cts_i_out = (ofstream *) 0, *cts_r_out = (ofstream *) 0;
-   ConcatString *cts_i_file = (ConcatString *) 0;
-   ConcatString *cts_r_file = (ConcatString *) 0;
-   ConcatString prefix;
+   BootStatTable *cts_i_tab = (BootStatTable *) 0;
+   BootStatTable *cts_r_tab = (BootStatTable *) 0;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -326,397 +381,352 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !cts_flag) return;
 
    //
-   // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // Allocate space to store categorical stats and the bootstrap
+   // statistics for each threshold
    //
-   cts_tmp    = new CTSInfo      [n_cts];
-   cts_i_out  = new ofstream     [n_cts];
-   cts_r_out  = new ofstream     [n_cts];
-   cts_i_file = new ConcatString [n_cts];
-   cts_r_file = new ConcatString [n_cts];
+   cts_tmp   = new CTSInfo [n_cts];
+   cts_i_tab = new BootStatTable [n_cts];
+   cts_r_tab = new BootStatTable [n_cts];
    for(i=0; i<n_cts; i++) {
       cts_tmp[i].fthresh = cts_info[i].fthresh;
       cts_tmp[i].othresh = cts_info[i].othresh;
       cts_tmp[i].cts.set_ec_value(cts_info[i].cts.ec_value());
+      cts_i_tab[i].set_size(n, n_cts_boot);
+      cts_r_tab[i].set_size(b, n_cts_boot);
    }
 
    //
-   // Build the temp file names
+   // Compute catgegorical stats from the raw data with the i-th data
+   // point removed
    //
    for(i=0; i<n_cts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_cts_i_" << i;
-      cts_i_file[i] = make_temp_file_name(prefix.c_str(), nullptr);
-
-      prefix << cs_erase << tmp_dir << "/tmp_cts_r_" << i;
-      cts_r_file[i] = make_temp_file_name(prefix.c_str(), nullptr);
-   }
+      for(j=0; j<n; j++) {
+         compute_i_ctsinfo(pd, j, false, cts_tmp[i]);
+         write_ctsinfo(cts_i_tab[i], j, cts_tmp[i]);
+      }
+   } // end for i
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   try {
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-      //
-      // Open up the temp files
-      //
-      for(i=0; i<n_cts; i++) {
-         cts_i_out[i].open(cts_i_file[i].c_str());
-         cts_r_out[i].open(cts_r_file[i].c_str());
-         if(!cts_i_out[i] || !cts_r_out[i]) {
-            mlog << Error << "\ncompute_cts_stats_ci_bca() -> "
-                 << "can't open one or more temporary files for writing:\n"
-                 << cts_i_file[i] << "\n"
-                 << cts_r_file[i] << "\n\n";
+   int rep_err = 0;
+
+#pragma omp parallel default(shared) private(i, j)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      CTSInfo *rep_tmp = new CTSInfo [n_cts];
+      for(j=0; j<n_cts; j++) rep_tmp[j] = cts_tmp[j];
+
+#pragma omp for schedule (static)
+      for(i=0; i<b; i++) {
+
+         //
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
+         //
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, n);
 
             //
-            // Attempt to delete temp files
+            // Compute categorical stats for each replicate with the
+            // cts_flag set and the normal_ci_flag unset
             //
-            for(i=0; i<n_cts; i++) {
-               remove_temp_file(cts_i_file[i]);
-               remove_temp_file(cts_r_file[i]);
-            }
-
-            // deallocate memory
-            if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-            if(cts_i_out)  { delete [] cts_i_out;  cts_i_out  = (ofstream *)     0; }
-            if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-            if(cts_i_file) { delete [] cts_i_file; cts_i_file = (ConcatString *) 0; }
-            if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
-            throw(1);
+            for(j=0; j<n_cts; j++) {
+               compute_ctsinfo(pd, ir_na, true, false, rep_tmp[j]);
+               write_ctsinfo(cts_r_tab[j], i, rep_tmp[j]);
+            } // end for j
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
          }
       }
 
-      //
-      // Compute catgegorical stats from the raw data with the i-th data
-      // point removed and write out to a temp file
-      //
-      for(i=0; i<n_cts; i++) {
-         for(j=0; j<n; j++) {
-            compute_i_ctsinfo(pd, j, false, cts_tmp[i]);
-            write_ctsinfo(cts_i_out[i], cts_tmp[i]);
-         }
-      } // end for i
+      if(rep_tmp) { delete [] rep_tmp; rep_tmp = (CTSInfo *) 0; }
+      gsl_rng_free(rep_rng);
 
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
+   } // end omp parallel
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_cts_stats_ci_bca() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
 
-         //
-         // Compute categorical stats for each replicate with the
-         // cts_flag set and the normal_ci_flag unset
-         //
-         for(j=0; j<n_cts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false, cts_tmp[j]);
-            write_ctsinfo(cts_r_out[j], cts_tmp[j]);
-         } // end for j
-      }
+   //
+   // Compute bootstrap intervals for each threshold value
+   //
+   for(i=0; i<n_cts; i++) {
 
       //
-      // Close the temp files
+      // Initialize column counter
       //
-      for(i=0; i<n_cts; i++) {
-         cts_i_out[i].close();
-         cts_r_out[i].close();
-      }
+      c = 0;
 
       //
-      // Compute bootstrap intervals for each threshold value
+      // Compute bootstrap interval for baser
       //
-      for(i=0; i<n_cts; i++) {
-
-         //
-         // Initialize column counter
-         //
-         c = 1;
-
-         //
-         // Compute bootstrap interval for baser
-         //
-         s = cts_info[i].baser.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].baser.v_bcl[j],
-                                 cts_info[i].baser.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fmean
-         //
-         s = cts_info[i].fmean.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].fmean.v_bcl[j],
-                                 cts_info[i].fmean.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for acc
-         //
-         s = cts_info[i].acc.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].acc.v_bcl[j],
-                                 cts_info[i].acc.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fbias
-         //
-         s = cts_info[i].fbias.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].fbias.v_bcl[j],
-                                 cts_info[i].fbias.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pody
-         //
-         s = cts_info[i].pody.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].pody.v_bcl[j],
-                                 cts_info[i].pody.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for podn
-         //
-         s = cts_info[i].podn.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].podn.v_bcl[j],
-                                 cts_info[i].podn.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pofd
-         //
-         s = cts_info[i].pofd.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].pofd.v_bcl[j],
-                                 cts_info[i].pofd.v_bcu[j]);
+      s = cts_info[i].baser.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].baser.v_bcl[j],
+                              cts_info[i].baser.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for far
-         //
-         s = cts_info[i].far.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].far.v_bcl[j],
-                                 cts_info[i].far.v_bcu[j]);
+      //
+      // Compute bootstrap interval for fmean
+      //
+      s = cts_info[i].fmean.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].fmean.v_bcl[j],
+                              cts_info[i].fmean.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for csi
-         //
-         s = cts_info[i].csi.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].csi.v_bcl[j],
-                                 cts_info[i].csi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for acc
+      //
+      s = cts_info[i].acc.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].acc.v_bcl[j],
+                              cts_info[i].acc.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for gss
-         //
-         s = cts_info[i].gss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].gss.v_bcl[j],
-                                 cts_info[i].gss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for fbias
+      //
+      s = cts_info[i].fbias.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].fbias.v_bcl[j],
+                              cts_info[i].fbias.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hk
-         //
-         s = cts_info[i].hk.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hk.v_bcl[j],
-                                 cts_info[i].hk.v_bcu[j]);
+      //
+      // Compute bootstrap interval for pody
+      //
+      s = cts_info[i].pody.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].pody.v_bcl[j],
+                              cts_info[i].pody.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hss
-         //
-         s = cts_info[i].hss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hss.v_bcl[j],
-                                 cts_info[i].hss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for podn
+      //
+      s = cts_info[i].podn.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].podn.v_bcl[j],
+                              cts_info[i].podn.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hss_ec
-         //
-         s = cts_info[i].hss_ec.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hss_ec.v_bcl[j],
-                                 cts_info[i].hss_ec.v_bcu[j]);
+      //
+      // Compute bootstrap interval for pofd
+      //
+      s = cts_info[i].pofd.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].pofd.v_bcl[j],
+                              cts_info[i].pofd.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for odds
-         //
-         s = cts_info[i].odds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].odds.v_bcl[j],
-                                 cts_info[i].odds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for far
+      //
+      s = cts_info[i].far.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].far.v_bcl[j],
+                              cts_info[i].far.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for lodds
-         //
-         s = cts_info[i].lodds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].lodds.v_bcl[j],
-                                 cts_info[i].lodds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for csi
+      //
+      s = cts_info[i].csi.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].csi.v_bcl[j],
+                              cts_info[i].csi.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for orss
-         //
-         s = cts_info[i].orss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].orss.v_bcl[j],
-                                 cts_info[i].orss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for gss
+      //
+      s = cts_info[i].gss.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].gss.v_bcl[j],
+                              cts_info[i].gss.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for eds
-         //
-         s = cts_info[i].eds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].eds.v_bcl[j],
-                                 cts_info[i].eds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hk
+      //
+      s = cts_info[i].hk.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hk.v_bcl[j],
+                              cts_info[i].hk.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for seds
-         //
-         s = cts_info[i].seds.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].seds.v_bcl[j],
-                                 cts_info[i].seds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hss
+      //
+      s = cts_info[i].hss.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hss.v_bcl[j],
+                              cts_info[i].hss.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for edi
-         //
-         s = cts_info[i].edi.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].edi.v_bcl[j],
-                                 cts_info[i].edi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hss_ec
+      //
+      s = cts_info[i].hss_ec.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hss_ec.v_bcl[j],
+                              cts_info[i].hss_ec.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for sedi
-         //
-         s = cts_info[i].sedi.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].sedi.v_bcl[j],
-                                 cts_info[i].sedi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for odds
+      //
+      s = cts_info[i].odds.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].odds.v_bcl[j],
+                              cts_info[i].odds.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for bagss
-         //
-         s = cts_info[i].bagss.v;
-         read_ldf(cts_i_file[i], c,   si_na);
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].bagss.v_bcl[j],
-                                 cts_info[i].bagss.v_bcu[j]);
-      } // end for i
+      //
+      // Compute bootstrap interval for lodds
+      //
+      s = cts_info[i].lodds.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].lodds.v_bcl[j],
+                              cts_info[i].lodds.v_bcu[j]);
 
-   } // end try block
+      //
+      // Compute bootstrap interval for orss
+      //
+      s = cts_info[i].orss.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].orss.v_bcl[j],
+                              cts_info[i].orss.v_bcu[j]);
 
-   //
-   // Catch any thrown errors
-   //
-   catch(int i_err) {
+      //
+      // Compute bootstrap interval for eds
+      //
+      s = cts_info[i].eds.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].eds.v_bcl[j],
+                              cts_info[i].eds.v_bcu[j]);
 
-      mlog << Error << "\ncompute_cts_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+      //
+      // Compute bootstrap interval for seds
+      //
+      s = cts_info[i].seds.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].seds.v_bcl[j],
+                              cts_info[i].seds.v_bcu[j]);
 
+      //
+      // Compute bootstrap interval for edi
+      //
+      s = cts_info[i].edi.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].edi.v_bcl[j],
+                              cts_info[i].edi.v_bcu[j]);
 
-      exit(i_err);
-   } // end catch block
+      //
+      // Compute bootstrap interval for sedi
+      //
+      s = cts_info[i].sedi.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].sedi.v_bcl[j],
+                              cts_info[i].sedi.v_bcu[j]);
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_cts; i++) {
-      remove_temp_file(cts_i_file[i]);
-      remove_temp_file(cts_r_file[i]);
-   }
+      //
+      // Compute bootstrap interval for bagss
+      //
+      s = cts_info[i].bagss.v;
+      cts_i_tab[i].get_col(c,   si_na);
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].bagss.v_bcl[j],
+                              cts_info[i].bagss.v_bcu[j]);
+   } // end for i
 
    //
    // Deallocate memory
    //
-   if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-   if(cts_i_out)  { delete [] cts_i_out;  cts_i_out  = (ofstream *)     0; }
-   if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-   if(cts_i_file) { delete [] cts_i_file; cts_i_file = (ConcatString *) 0; }
-   if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
+   if(cts_tmp)   { delete [] cts_tmp;   cts_tmp   = (CTSInfo *)       0; }
+   if(cts_i_tab) { delete [] cts_i_tab; cts_i_tab = (BootStatTable *) 0; }
+   if(cts_r_tab) { delete [] cts_r_tab; cts_r_tab = (BootStatTable *) 0; }
 
    return;
 }
@@ -737,19 +747,18 @@ void compute_cts_stats_ci_bca(const gsl_rng *rng_ptr,
 void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
                                const PairDataPoint &pd,
                                int b, MCTSInfo &mcts_info,
-                               bool mcts_flag, bool rank_flag,
-                               const char *tmp_dir) {
+                               bool mcts_flag, bool rank_flag) {
    int n = 0;
    int i, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
+   NumArray i_na, si_na, sr_na;
    MCTSInfo mcts_tmp;
 
    //
-   // Temp file streams for categorical statistics
+   // Bootstrap statistics
    //
-   ofstream mcts_i_out, mcts_r_out;
-   ConcatString mcts_i_file, mcts_r_file, prefix;
+   BootStatTable mcts_i_tab, mcts_r_tab;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -787,153 +796,132 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
    mcts_tmp = mcts_info;
 
    //
-   // Build the temp file names
+   // Allocate space to store the bootstrap statistics
    //
-   prefix << cs_erase << tmp_dir << "/tmp_mcts_i";
-   mcts_i_file = make_temp_file_name(prefix.c_str(), nullptr);
+   mcts_i_tab.set_size(n, n_mcts_boot);
+   mcts_r_tab.set_size(b, n_mcts_boot);
 
-   prefix << cs_erase << tmp_dir << "/tmp_mcts_r";
-   mcts_r_file = make_temp_file_name(prefix.c_str(), nullptr);
+   //
+   // Compute catgegorical stats from the raw data with the i-th data
+   // point removed
+   //
+   for(i=0; i<n; i++) {
+      compute_i_mctsinfo(pd, i, false, mcts_tmp);
+      write_mctsinfo(mcts_i_tab, i, mcts_tmp);
+   }
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   try {
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-      //
-      // Open up the temp files
-      //
-      mcts_i_out.open(mcts_i_file.c_str());
-      mcts_r_out.open(mcts_r_file.c_str());
-      if(!mcts_i_out || !mcts_r_out) {
-         mlog << Error << "\ncompute_mcts_stats_ci_bca() -> "
-              << "can't open one or more temporary files for writing:\n"
-              << mcts_i_file << "\n"
-              << mcts_r_file << "\n\n";
-         throw(1);
-      }
+   int rep_err = 0;
 
-      //
-      // Compute catgegorical stats from the raw data with the i-th data
-      // point removed and write out to a temp file
-      //
-      for(i=0; i<n; i++) {
-         compute_i_mctsinfo(pd, i, false, mcts_tmp);
-         write_mctsinfo(mcts_i_out, mcts_tmp);
-      } // end for i
+#pragma omp parallel default(shared) private(i)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      MCTSInfo rep_tmp = mcts_tmp;
 
-      //
-      // Resample the array of indices with replacement
-      //
+#pragma omp for schedule (static)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
-
          //
-         // Compute categorical stats for each replicate with the
-         // cts_flag set and the normal_ci_flag unset
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
          //
-         compute_mctsinfo(pd, ir_na, true, false, mcts_tmp);
-         write_mctsinfo(mcts_r_out, mcts_tmp);
-      }
-
-      //
-      // Close the temp files
-      //
-      mcts_i_out.close();
-      mcts_r_out.close();
-
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for acc
-      //
-      s = mcts_info.acc.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              mcts_info.alpha[i],
-                              mcts_info.acc.v_bcl[i],
-                              mcts_info.acc.v_bcu[i]);
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, n);
 
-      //
-      // Compute bootstrap interval for hk
-      //
-      s = mcts_info.hk.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              mcts_info.alpha[i],
-                              mcts_info.hk.v_bcl[i],
-                              mcts_info.hk.v_bcu[i]);
+            //
+            // Compute multi-category stats for each replicate with the
+            // mcts_flag set and the normal_ci_flag unset
+            //
+            compute_mctsinfo(pd, ir_na, true, false, rep_tmp);
+            write_mctsinfo(mcts_r_tab, i, rep_tmp);
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
+         }
+      }
 
-      //
-      // Compute bootstrap interval for hss
-      //
-      s = mcts_info.hss.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              mcts_info.alpha[i],
-                              mcts_info.hss.v_bcl[i],
-                              mcts_info.hss.v_bcu[i]);
+      gsl_rng_free(rep_rng);
 
-      //
-      // Compute bootstrap interval for hss_ec
-      //
-      s = mcts_info.hss_ec.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              mcts_info.alpha[i],
-                              mcts_info.hss_ec.v_bcl[i],
-                              mcts_info.hss_ec.v_bcu[i]);
+   } // end omp parallel
 
-      //
-      // Compute bootstrap interval for ger
-      //
-      s = mcts_info.ger.v;
-      read_ldf(mcts_i_file, c,   si_na);
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              mcts_info.alpha[i],
-                              mcts_info.ger.v_bcl[i],
-                              mcts_info.ger.v_bcu[i]);
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_mcts_stats_ci_bca() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
 
-   } // end try block
+   //
+   // Initialize column counter
+   //
+   c = 0;
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for acc
    //
-   catch(int i_err) {
+   s = mcts_info.acc.v;
+   mcts_i_tab.get_col(c,   si_na);
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           mcts_info.alpha[i],
+                           mcts_info.acc.v_bcl[i],
+                           mcts_info.acc.v_bcu[i]);
 
-      mlog << Error << "\ncompute_mcts_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   //
+   // Compute bootstrap interval for hk
+   //
+   s = mcts_info.hk.v;
+   mcts_i_tab.get_col(c,   si_na);
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           mcts_info.alpha[i],
+                           mcts_info.hk.v_bcl[i],
+                           mcts_info.hk.v_bcu[i]);
 
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(mcts_i_file);
-      remove_temp_file(mcts_r_file);
+   //
+   // Compute bootstrap interval for hss
+   //
+   s = mcts_info.hss.v;
+   mcts_i_tab.get_col(c,   si_na);
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           mcts_info.alpha[i],
+                           mcts_info.hss.v_bcl[i],
+                           mcts_info.hss.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for hss_ec
+   //
+   s = mcts_info.hss_ec.v;
+   mcts_i_tab.get_col(c,   si_na);
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           mcts_info.alpha[i],
+                           mcts_info.hss_ec.v_bcl[i],
+                           mcts_info.hss_ec.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for ger
    //
-   remove_temp_file(mcts_i_file);
-   remove_temp_file(mcts_r_file);
+   s = mcts_info.ger.v;
+   mcts_i_tab.get_col(c,   si_na);
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           mcts_info.alpha[i],
+                           mcts_info.ger.v_bcl[i],
+                           mcts_info.ger.v_bcu[i]);
 
    return;
 }
@@ -955,19 +943,18 @@ void compute_mcts_stats_ci_bca(const gsl_rng *rng_ptr,
 void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
                               const PairDataPoint &pd,
                               bool precip_flag, bool rank_flag,
-                              int b, CNTInfo &cnt_info,
-                              const char *tmp_dir) {
+                              int b, CNTInfo &cnt_info) {
    int n =0;
    int i, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
+   NumArray i_na, si_na, sr_na;
    CNTInfo cnt_tmp;
 
    //
-   // Temp file streams for continuous statistics
+   // Bootstrap statistics
    //
-   ofstream cnt_i_out, cnt_r_out;
-   ConcatString cnt_i_file, cnt_r_file, prefix;
+   BootStatTable cnt_i_tab, cnt_r_tab;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -999,406 +986,385 @@ void compute_cnt_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1) return;
 
    //
-   // Build the temp file names
+   // Allocate space to store the bootstrap statistics
    //
-   prefix << cs_erase << tmp_dir << "/tmp_cnt_i";
-   cnt_i_file = make_temp_file_name(prefix.c_str(), nullptr);
+   cnt_i_tab.set_size(n, n_cnt_boot);
+   cnt_r_tab.set_size(b, n_cnt_boot);
 
-   prefix << cs_erase << tmp_dir << "/tmp_cnt_r";
-   cnt_r_file = make_temp_file_name(prefix.c_str(), nullptr);
+   //
+   // Compute continuous stats from the raw data with the i-th data
+   // point removed
+   //
+   for(i=0; i<n; i++) {
+      compute_i_cntinfo(pd, i, precip_flag, false, false, cnt_tmp);
+      write_cntinfo(cnt_i_tab, i, cnt_tmp);
+   }
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   try {
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-      //
-      // Open up the temp files
-      //
-      cnt_i_out.open(cnt_i_file.c_str());
-      cnt_r_out.open(cnt_r_file.c_str());
-      if(!cnt_i_out || !cnt_r_out) {
-         mlog << Error << "\ncompute_cnt_stats_ci_bca() -> "
-              << "can't open one or more temporary files for writing:\n"
-              << cnt_i_file << "\n"
-              << cnt_r_file << "\n\n";
-         throw(1);
-      }
+   int rep_err = 0;
 
-      //
-      // Compute continuous stats from the raw data with the i-th data
-      // point removed and write out to a temp file
-      //
-      for(i=0; i<n; i++) {
-         compute_i_cntinfo(pd, i, precip_flag, false, false, cnt_tmp);
-         write_cntinfo(cnt_i_out, cnt_tmp);
-      }
+#pragma omp parallel default(shared) private(i)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      CNTInfo rep_tmp = cnt_tmp;
 
-      //
-      // Resample the array of indices with replacement
-      //
+#pragma omp for schedule (static)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
-
          //
-         // Compute continuous stats for each replicate with the
-         // rank_flag and normal_ci_flag unset
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
          //
-         compute_cntinfo(pd, ir_na, precip_flag, false, false, cnt_tmp);
-         write_cntinfo(cnt_r_out, cnt_tmp);
-      }
-
-      //
-      // Close the temp files
-      //
-      cnt_i_out.close();
-      cnt_r_out.close();
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, n);
 
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for fbar
-      //
-      s = cnt_info.fbar.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.fbar.v_bcl[i],
-                              cnt_info.fbar.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for fstdev
-      //
-      s = cnt_info.fstdev.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.fstdev.v_bcl[i],
-                              cnt_info.fstdev.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for obar
-      //
-      s = cnt_info.obar.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.obar.v_bcl[i],
-                              cnt_info.obar.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for ostdev
-      //
-      s = cnt_info.ostdev.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.ostdev.v_bcl[i],
-                              cnt_info.ostdev.v_bcu[i]);
-
-
-      //
-      // Compute bootstrap interval for pr_corr
-      //
-      s = cnt_info.pr_corr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.pr_corr.v_bcl[i],
-                              cnt_info.pr_corr.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for anom_corr
-      //
-      s = cnt_info.anom_corr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.anom_corr.v_bcl[i],
-                              cnt_info.anom_corr.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for rmsfa
-      //
-      s = cnt_info.rmsfa.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.rmsfa.v_bcl[i],
-                              cnt_info.rmsfa.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for rmsoa
-      //
-      s = cnt_info.rmsoa.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.rmsoa.v_bcl[i],
-                              cnt_info.rmsoa.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for anom_corr_uncntr
-      //
-      s = cnt_info.anom_corr_uncntr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.anom_corr_uncntr.v_bcl[i],
-                              cnt_info.anom_corr_uncntr.v_bcu[i]);
+            //
+            // Compute continuous stats for each replicate with the
+            // rank_flag and normal_ci_flag unset
+            //
+            compute_cntinfo(pd, ir_na, precip_flag, false, false, rep_tmp);
+            write_cntinfo(cnt_r_tab, i, rep_tmp);
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
+         }
+      }
 
-      //
-      // Compute bootstrap interval for me
-      //
-      s = cnt_info.me.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.me.v_bcl[i],
-                              cnt_info.me.v_bcu[i]);
+      gsl_rng_free(rep_rng);
 
-      //
-      // Compute bootstrap interval for me2
-      //
-      s = cnt_info.me2.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.me2.v_bcl[i],
-                              cnt_info.me2.v_bcu[i]);
+   } // end omp parallel
 
-      //
-      // Compute bootstrap interval for estdev
-      //
-      s = cnt_info.estdev.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.estdev.v_bcl[i],
-                              cnt_info.estdev.v_bcu[i]);
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_cnt_stats_ci_bca() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
 
-      //
-      // Compute bootstrap interval for mbias
-      //
-      s = cnt_info.mbias.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.mbias.v_bcl[i],
-                              cnt_info.mbias.v_bcu[i]);
+   //
+   // Initialize column counter
+   //
+   c = 0;
 
-      //
-      // Compute bootstrap interval for mae
-      //
-      s = cnt_info.mae.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.mae.v_bcl[i],
-                              cnt_info.mae.v_bcu[i]);
+   //
+   // Compute bootstrap interval for fbar
+   //
+   s = cnt_info.fbar.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.fbar.v_bcl[i],
+                           cnt_info.fbar.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mse
-      //
-      s = cnt_info.mse.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.mse.v_bcl[i],
-                              cnt_info.mse.v_bcu[i]);
+   //
+   // Compute bootstrap interval for fstdev
+   //
+   s = cnt_info.fstdev.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.fstdev.v_bcl[i],
+                           cnt_info.fstdev.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for msess
-      //
-      s = cnt_info.msess.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.msess.v_bcl[i],
-                              cnt_info.msess.v_bcu[i]);
+   //
+   // Compute bootstrap interval for obar
+   //
+   s = cnt_info.obar.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.obar.v_bcl[i],
+                           cnt_info.obar.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for bcmse
-      //
-      s = cnt_info.bcmse.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.bcmse.v_bcl[i],
-                              cnt_info.bcmse.v_bcu[i]);
+   //
+   // Compute bootstrap interval for ostdev
+   //
+   s = cnt_info.ostdev.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.ostdev.v_bcl[i],
+                           cnt_info.ostdev.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for rmse
-      //
-      s = cnt_info.rmse.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.rmse.v_bcl[i],
-                              cnt_info.rmse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for si
-      //
-      s = cnt_info.si.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.si.v_bcl[i],
-                              cnt_info.si.v_bcu[i]);
+   //
+   // Compute bootstrap interval for pr_corr
+   //
+   s = cnt_info.pr_corr.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.pr_corr.v_bcl[i],
+                           cnt_info.pr_corr.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e10
-      //
-      s = cnt_info.e10.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e10.v_bcl[i],
-                              cnt_info.e10.v_bcu[i]);
+   //
+   // Compute bootstrap interval for anom_corr
+   //
+   s = cnt_info.anom_corr.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.anom_corr.v_bcl[i],
+                           cnt_info.anom_corr.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e25
-      //
-      s = cnt_info.e25.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e25.v_bcl[i],
-                              cnt_info.e25.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmsfa
+   //
+   s = cnt_info.rmsfa.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.rmsfa.v_bcl[i],
+                           cnt_info.rmsfa.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e50
-      //
-      s = cnt_info.e50.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e50.v_bcl[i],
-                              cnt_info.e50.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmsoa
+   //
+   s = cnt_info.rmsoa.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.rmsoa.v_bcl[i],
+                           cnt_info.rmsoa.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e75
-      //
-      s = cnt_info.e75.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e75.v_bcl[i],
-                              cnt_info.e75.v_bcu[i]);
+   //
+   // Compute bootstrap interval for anom_corr_uncntr
+   //
+   s = cnt_info.anom_corr_uncntr.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.anom_corr_uncntr.v_bcl[i],
+                           cnt_info.anom_corr_uncntr.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e90
-      //
-      s = cnt_info.e90.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.e90.v_bcl[i],
-                              cnt_info.e90.v_bcu[i]);
+   //
+   // Compute bootstrap interval for me
+   //
+   s = cnt_info.me.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.me.v_bcl[i],
+                           cnt_info.me.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for eiqr
-      //
-      s = cnt_info.eiqr.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.eiqr.v_bcl[i],
-                              cnt_info.eiqr.v_bcu[i]);
+   //
+   // Compute bootstrap interval for me2
+   //
+   s = cnt_info.me2.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.me2.v_bcl[i],
+                           cnt_info.me2.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mad
-      //
-      s = cnt_info.mad.v;
-      read_ldf(cnt_i_file, c,   si_na);
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              cnt_info.alpha[i],
-                              cnt_info.mad.v_bcl[i],
-                              cnt_info.mad.v_bcu[i]);
-   } // end try block
+   //
+   // Compute bootstrap interval for estdev
+   //
+   s = cnt_info.estdev.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.estdev.v_bcl[i],
+                           cnt_info.estdev.v_bcu[i]);
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for mbias
    //
-   catch(int i_err) {
+   s = cnt_info.mbias.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.mbias.v_bcl[i],
+                           cnt_info.mbias.v_bcu[i]);
 
-      mlog << Error << "\ncompute_cnt_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   //
+   // Compute bootstrap interval for mae
+   //
+   s = cnt_info.mae.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.mae.v_bcl[i],
+                           cnt_info.mae.v_bcu[i]);
 
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(cnt_i_file);
-      remove_temp_file(cnt_r_file);
+   //
+   // Compute bootstrap interval for mse
+   //
+   s = cnt_info.mse.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.mse.v_bcl[i],
+                           cnt_info.mse.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for msess
+   //
+   s = cnt_info.msess.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.msess.v_bcl[i],
+                           cnt_info.msess.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for bcmse
    //
-   remove_temp_file(cnt_i_file);
-   remove_temp_file(cnt_r_file);
+   s = cnt_info.bcmse.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.bcmse.v_bcl[i],
+                           cnt_info.bcmse.v_bcu[i]);
 
+   //
+   // Compute bootstrap interval for rmse
+   //
+   s = cnt_info.rmse.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.rmse.v_bcl[i],
+                           cnt_info.rmse.v_bcu[i]);
+
+   //
+   // Compute bootstrap interval for si
+   //
+   s = cnt_info.si.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.si.v_bcl[i],
+                           cnt_info.si.v_bcu[i]);
+
+   //
+   // Compute bootstrap interval for e10
+   //
+   s = cnt_info.e10.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e10.v_bcl[i],
+                           cnt_info.e10.v_bcu[i]);
+
+   //
+   // Compute bootstrap interval for e25
+   //
+   s = cnt_info.e25.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e25.v_bcl[i],
+                           cnt_info.e25.v_bcu[i]);
+
+   //
+   // Compute bootstrap interval for e50
+   //
+   s = cnt_info.e50.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e50.v_bcl[i],
+                           cnt_info.e50.v_bcu[i]);
+
+   //
+   // Compute bootstrap interval for e75
+   //
+   s = cnt_info.e75.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e75.v_bcl[i],
+                           cnt_info.e75.v_bcu[i]);
+
+   //
+   // Compute bootstrap interval for e90
+   //
+   s = cnt_info.e90.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.e90.v_bcl[i],
+                           cnt_info.e90.v_bcu[i]);
+
+   //
+   // Compute bootstrap interval for eiqr
+   //
+   s = cnt_info.eiqr.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.eiqr.v_bcl[i],
+                           cnt_info.eiqr.v_bcu[i]);
+
+   //
+   // Compute bootstrap interval for mad
+   //
+   s = cnt_info.mad.v;
+   cnt_i_tab.get_col(c,   si_na);
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           cnt_info.alpha[i],
+                           cnt_info.mad.v_bcl[i],
+                           cnt_info.mad.v_bcu[i]);
    return;
 }
 
@@ -1414,19 +1380,18 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
                                const PairDataPoint &pd,
                                int b, double m_prop,
                                CTSInfo *&cts_info, int n_cts,
-                               bool cts_flag, bool rank_flag,
-                               const char *tmp_dir) {
+                               bool cts_flag, bool rank_flag) {
    int n = 0;
    int i, j, m, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
+   NumArray i_na, sr_na;
    CTSInfo *cts_tmp = (CTSInfo *) 0;
 
    //
-   // Temp file streams for categorical statistics
+   // Bootstrap statistics for each threshold
    //
-   ofstream *cts_r_out = (ofstream *) 0;
-   ConcatString *cts_r_file = (ConcatString *) 0, prefix;
+   BootStatTable *cts_r_tab = (BootStatTable *) 0;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -1466,345 +1431,317 @@ void compute_cts_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !cts_flag) return;
 
    //
-   // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // Allocate space to store categorical stats and the bootstrap
+   // statistics for each threshold
    //
-   cts_tmp    = new CTSInfo [n_cts];
-   cts_r_out  = new ofstream [n_cts];
-   cts_r_file = new ConcatString [n_cts];
+   cts_tmp   = new CTSInfo [n_cts];
+   cts_r_tab = new BootStatTable [n_cts];
    for(i=0; i<n_cts; i++) {
       cts_tmp[i].fthresh = cts_info[i].fthresh;
       cts_tmp[i].othresh = cts_info[i].othresh;
       cts_tmp[i].cts.set_ec_value(cts_info[i].cts.ec_value());
+      cts_r_tab[i].set_size(b, n_cts_boot);
    }
 
    //
-   // Build the temp file names
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   for(i=0; i<n_cts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_cts_r_" << i;
-      cts_r_file[i] = make_temp_file_name(prefix.c_str(), nullptr);
-   }
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-   //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
-   //
-   try {
+   int rep_err = 0;
 
-      //
-      // Open up the temp files
-      //
-      for(i=0; i<n_cts; i++) {
-         cts_r_out[i].open(cts_r_file[i].c_str());
-         if(!cts_r_out[i]) {
-            mlog << Error << "\ncompute_cts_stats_ci_perc() -> "
-                 << "can't open the temporary file for writing:\n"
-                 << cts_r_file[i] << "\n\n";
-           //
-           // Attempt to delete temp files
-           //
-           for(i=0; i<n_cts; i++) remove_temp_file(cts_r_file[i]);
+#pragma omp parallel default(shared) private(i, j)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      CTSInfo *rep_tmp = new CTSInfo [n_cts];
+      for(j=0; j<n_cts; j++) rep_tmp[j] = cts_tmp[j];
 
-           if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-           if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-           if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
+#pragma omp for schedule (static)
+      for(i=0; i<b; i++) {
 
-            throw(1);
+         //
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
+         //
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, m);
+
+            //
+            // Compute categorical stats for each replicate with the
+            // cts_flag set and the normal_ci_flag unset
+            //
+            for(j=0; j<n_cts; j++) {
+               compute_ctsinfo(pd, ir_na, true, false, rep_tmp[j]);
+               write_ctsinfo(cts_r_tab[j], i, rep_tmp[j]);
+            } // end for j
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
          }
       }
 
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
+      if(rep_tmp) { delete [] rep_tmp; rep_tmp = (CTSInfo *) 0; }
+      gsl_rng_free(rep_rng);
 
-         ran_sample(rng_ptr, i_na, ir_na, m);
+   } // end omp parallel
 
-         //
-         // Compute categorical stats for each replicate with the
-         // cts_flag set and the normal_ci_flag unset
-         //
-         for(j=0; j<n_cts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false, cts_tmp[j]);
-            write_ctsinfo(cts_r_out[j], cts_tmp[j]);
-         } // end for j
-      }
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_cts_stats_ci_perc() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
+
+   //
+   // Compute bootstrap intervals for each threshold value
+   //
+   for(i=0; i<n_cts; i++) {
 
       //
-      // Close the temp files
+      // Initialize column counter
       //
-      for(i=0; i<n_cts; i++) cts_r_out[i].close();
+      c = 0;
 
       //
-      // Compute bootstrap intervals for each threshold value
+      // Compute bootstrap interval for baser
       //
-      for(i=0; i<n_cts; i++) {
-
-         //
-         // Initialize column counter
-         //
-         c = 1;
-
-         //
-         // Compute bootstrap interval for baser
-         //
-         s = cts_info[i].baser.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].baser.v_bcl[j],
-                                 cts_info[i].baser.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fmean
-         //
-         s = cts_info[i].fmean.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].fmean.v_bcl[j],
-                                 cts_info[i].fmean.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for acc
-         //
-         s = cts_info[i].acc.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].acc.v_bcl[j],
-                                 cts_info[i].acc.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fbias
-         //
-         s = cts_info[i].fbias.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].fbias.v_bcl[j],
-                                 cts_info[i].fbias.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pody
-         //
-         s = cts_info[i].pody.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].pody.v_bcl[j],
-                                 cts_info[i].pody.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for podn
-         //
-         s = cts_info[i].podn.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].podn.v_bcl[j],
-                                 cts_info[i].podn.v_bcu[j]);
+      s = cts_info[i].baser.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].baser.v_bcl[j],
+                              cts_info[i].baser.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for pofd
-         //
-         s = cts_info[i].pofd.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].pofd.v_bcl[j],
-                                 cts_info[i].pofd.v_bcu[j]);
+      //
+      // Compute bootstrap interval for fmean
+      //
+      s = cts_info[i].fmean.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].fmean.v_bcl[j],
+                              cts_info[i].fmean.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for far
-         //
-         s = cts_info[i].far.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].far.v_bcl[j],
-                                 cts_info[i].far.v_bcu[j]);
+      //
+      // Compute bootstrap interval for acc
+      //
+      s = cts_info[i].acc.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].acc.v_bcl[j],
+                              cts_info[i].acc.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for csi
-         //
-         s = cts_info[i].csi.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].csi.v_bcl[j],
-                                 cts_info[i].csi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for fbias
+      //
+      s = cts_info[i].fbias.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].fbias.v_bcl[j],
+                              cts_info[i].fbias.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for gss
-         //
-         s = cts_info[i].gss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].gss.v_bcl[j],
-                                 cts_info[i].gss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for pody
+      //
+      s = cts_info[i].pody.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].pody.v_bcl[j],
+                              cts_info[i].pody.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hk
-         //
-         s = cts_info[i].hk.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hk.v_bcl[j],
-                                 cts_info[i].hk.v_bcu[j]);
+      //
+      // Compute bootstrap interval for podn
+      //
+      s = cts_info[i].podn.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].podn.v_bcl[j],
+                              cts_info[i].podn.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hss
-         //
-         s = cts_info[i].hss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hss.v_bcl[j],
-                                 cts_info[i].hss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for pofd
+      //
+      s = cts_info[i].pofd.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].pofd.v_bcl[j],
+                              cts_info[i].pofd.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hss_ec
-         //
-         s = cts_info[i].hss_ec.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].hss_ec.v_bcl[j],
-                                 cts_info[i].hss_ec.v_bcu[j]);
+      //
+      // Compute bootstrap interval for far
+      //
+      s = cts_info[i].far.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].far.v_bcl[j],
+                              cts_info[i].far.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for odds
-         //
-         s = cts_info[i].odds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].odds.v_bcl[j],
-                                 cts_info[i].odds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for csi
+      //
+      s = cts_info[i].csi.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].csi.v_bcl[j],
+                              cts_info[i].csi.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for lodds
-         //
-         s = cts_info[i].lodds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].lodds.v_bcl[j],
-                                 cts_info[i].lodds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for gss
+      //
+      s = cts_info[i].gss.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].gss.v_bcl[j],
+                              cts_info[i].gss.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for orss
-         //
-         s = cts_info[i].orss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].orss.v_bcl[j],
-                                 cts_info[i].orss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hk
+      //
+      s = cts_info[i].hk.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hk.v_bcl[j],
+                              cts_info[i].hk.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for eds
-         //
-         s = cts_info[i].eds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].eds.v_bcl[j],
-                                 cts_info[i].eds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hss
+      //
+      s = cts_info[i].hss.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hss.v_bcl[j],
+                              cts_info[i].hss.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for seds
-         //
-         s = cts_info[i].seds.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].seds.v_bcl[j],
-                                 cts_info[i].seds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hss_ec
+      //
+      s = cts_info[i].hss_ec.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].hss_ec.v_bcl[j],
+                              cts_info[i].hss_ec.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for edi
-         //
-         s = cts_info[i].edi.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].edi.v_bcl[j],
-                                 cts_info[i].edi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for odds
+      //
+      s = cts_info[i].odds.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].odds.v_bcl[j],
+                              cts_info[i].odds.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for sedi
-         //
-         s = cts_info[i].sedi.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].sedi.v_bcl[j],
-                                 cts_info[i].sedi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for lodds
+      //
+      s = cts_info[i].lodds.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].lodds.v_bcl[j],
+                              cts_info[i].lodds.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for bagss
-         //
-         s = cts_info[i].bagss.v;
-         read_ldf(cts_r_file[i], c++, sr_na);
-         for(j=0; j<cts_info[i].n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 cts_info[i].alpha[j],
-                                 cts_info[i].bagss.v_bcl[j],
-                                 cts_info[i].bagss.v_bcu[j]);
-      } // end for i
+      //
+      // Compute bootstrap interval for orss
+      //
+      s = cts_info[i].orss.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].orss.v_bcl[j],
+                              cts_info[i].orss.v_bcu[j]);
 
-   } // end try block
+      //
+      // Compute bootstrap interval for eds
+      //
+      s = cts_info[i].eds.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].eds.v_bcl[j],
+                              cts_info[i].eds.v_bcu[j]);
 
-   //
-   // Catch any thrown errors
-   //
-   catch(int i_err) {
+      //
+      // Compute bootstrap interval for seds
+      //
+      s = cts_info[i].seds.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].seds.v_bcl[j],
+                              cts_info[i].seds.v_bcu[j]);
 
-      mlog << Error << "\ncompute_cts_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+      //
+      // Compute bootstrap interval for edi
+      //
+      s = cts_info[i].edi.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].edi.v_bcl[j],
+                              cts_info[i].edi.v_bcu[j]);
 
-      exit(i_err);
-   } // end catch block
+      //
+      // Compute bootstrap interval for sedi
+      //
+      s = cts_info[i].sedi.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].sedi.v_bcl[j],
+                              cts_info[i].sedi.v_bcu[j]);
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_cts; i++) {
-      remove_temp_file(cts_r_file[i]);
-   }
+      //
+      // Compute bootstrap interval for bagss
+      //
+      s = cts_info[i].bagss.v;
+      cts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<cts_info[i].n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              cts_info[i].alpha[j],
+                              cts_info[i].bagss.v_bcl[j],
+                              cts_info[i].bagss.v_bcu[j]);
+   } // end for i
 
    //
    // Deallocate memory
    //
-   if(cts_tmp)    { delete [] cts_tmp;    cts_tmp    = (CTSInfo *)      0; }
-   if(cts_r_out)  { delete [] cts_r_out;  cts_r_out  = (ofstream *)     0; }
-   if(cts_r_file) { delete [] cts_r_file; cts_r_file = (ConcatString *) 0; }
+   if(cts_tmp)   { delete [] cts_tmp;   cts_tmp   = (CTSInfo *)       0; }
+   if(cts_r_tab) { delete [] cts_r_tab; cts_r_tab = (BootStatTable *) 0; }
 
    return;
 }
@@ -1821,19 +1758,18 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
                                 const PairDataPoint &pd,
                                 int b, double m_prop,
                                 MCTSInfo &mcts_info,
-                                bool mcts_flag, bool rank_flag,
-                                const char *tmp_dir) {
+                                bool mcts_flag, bool rank_flag) {
    int n = 0;
    int i, m, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
+   NumArray i_na, sr_na;
    MCTSInfo mcts_tmp;
 
    //
-   // Temp file streams for categorical statistics
+   // Bootstrap statistics
    //
-   ofstream mcts_r_out;
-   ConcatString mcts_r_file, prefix;
+   BootStatTable mcts_r_tab;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -1876,132 +1812,118 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
    mcts_tmp = mcts_info;
 
    //
-   // Build the temp file names
+   // Allocate space to store the bootstrap statistics
    //
-   prefix << cs_erase << tmp_dir << "/tmp_mcts_r";
-   mcts_r_file = make_temp_file_name(prefix.c_str(), nullptr);
+   mcts_r_tab.set_size(b, n_mcts_boot);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   try {
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-      //
-      // Open up the temp file
-      //
-      mcts_r_out.open(mcts_r_file.c_str());
-      if(!mcts_r_out) {
-         mlog << Error << "\ncompute_mcts_stats_ci_perc() -> "
-              << "can't open the temporary file for writing:\n"
-              << mcts_r_file << "\n\n";
-         throw(1);
-      }
+   int rep_err = 0;
 
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
+#pragma omp parallel default(shared) private(i)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      MCTSInfo rep_tmp = mcts_tmp;
 
-         ran_sample(rng_ptr, i_na, ir_na, m);
+#pragma omp for schedule (static)
+      for(i=0; i<b; i++) {
 
          //
-         // Compute multi-category stats for each replicate with the
-         // mcts_flag set and the normal_ci_flag unset
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
          //
-         compute_mctsinfo(pd, ir_na, true, false, mcts_tmp);
-         write_mctsinfo(mcts_r_out, mcts_tmp);
-      }
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, m);
 
-      //
-      // Close the temp file
-      //
-      mcts_r_out.close();
-
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for acc
-      //
-      s = mcts_info.acc.v;
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               mcts_info.alpha[i],
-                               mcts_info.acc.v_bcl[i],
-                               mcts_info.acc.v_bcu[i]);
-
-      //
-      // Compute bootstrap interval for hk
-      //
-      s = mcts_info.hk.v;
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               mcts_info.alpha[i],
-                               mcts_info.hk.v_bcl[i],
-                               mcts_info.hk.v_bcu[i]);
+            //
+            // Compute multi-category stats for each replicate with the
+            // mcts_flag set and the normal_ci_flag unset
+            //
+            compute_mctsinfo(pd, ir_na, true, false, rep_tmp);
+            write_mctsinfo(mcts_r_tab, i, rep_tmp);
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
+         }
+      }
 
-      //
-      // Compute bootstrap interval for hss
-      //
-      s = mcts_info.hss.v;
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               mcts_info.alpha[i],
-                               mcts_info.hss.v_bcl[i],
-                               mcts_info.hss.v_bcu[i]);
+      gsl_rng_free(rep_rng);
 
-      //
-      // Compute bootstrap interval for hss_ec
-      //
-      s = mcts_info.hss_ec.v;
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               mcts_info.alpha[i],
-                               mcts_info.hss_ec.v_bcl[i],
-                               mcts_info.hss_ec.v_bcu[i]);
+   } // end omp parallel
 
-      //
-      //
-      // Compute bootstrap interval for ger
-      //
-      s = mcts_info.ger.v;
-      read_ldf(mcts_r_file, c++, sr_na);
-      for(i=0; i<mcts_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               mcts_info.alpha[i],
-                               mcts_info.ger.v_bcl[i],
-                               mcts_info.ger.v_bcu[i]);
-   } // end try block
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_mcts_stats_ci_perc() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
 
    //
-   // Catch any thrown errors
+   // Initialize column counter
    //
-   catch(int i_err) {
+   c = 0;
 
-      mlog << Error << "\ncompute_mcts_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   //
+   // Compute bootstrap interval for acc
+   //
+   s = mcts_info.acc.v;
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            mcts_info.alpha[i],
+                            mcts_info.acc.v_bcl[i],
+                            mcts_info.acc.v_bcu[i]);
 
-      //
-      // Attempt to delete temp file
-      //
-      remove_temp_file(mcts_r_file);
+   //
+   // Compute bootstrap interval for hk
+   //
+   s = mcts_info.hk.v;
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            mcts_info.alpha[i],
+                            mcts_info.hk.v_bcl[i],
+                            mcts_info.hk.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for hss
+   //
+   s = mcts_info.hss.v;
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            mcts_info.alpha[i],
+                            mcts_info.hss.v_bcl[i],
+                            mcts_info.hss.v_bcu[i]);
 
    //
-   // Delete temp file
+   // Compute bootstrap interval for hss_ec
    //
-   remove_temp_file(mcts_r_file);
+   s = mcts_info.hss_ec.v;
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            mcts_info.alpha[i],
+                            mcts_info.hss_ec.v_bcl[i],
+                            mcts_info.hss_ec.v_bcu[i]);
 
+   //
+   //
+   // Compute bootstrap interval for ger
+   //
+   s = mcts_info.ger.v;
+   mcts_r_tab.get_col(c++, sr_na);
+   for(i=0; i<mcts_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            mcts_info.alpha[i],
+                            mcts_info.ger.v_bcl[i],
+                            mcts_info.ger.v_bcu[i]);
    return;
 }
 
@@ -2016,19 +1938,18 @@ void compute_mcts_stats_ci_perc(const gsl_rng *rng_ptr,
 void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
                                const PairDataPoint &pd,
                                bool precip_flag, bool rank_flag,
-                               int b, double m_prop, CNTInfo &cnt_info,
-                               const char *tmp_dir) {
+                               int b, double m_prop, CNTInfo &cnt_info) {
    int n = 0;
    int i, m, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
+   NumArray i_na, sr_na;
    CNTInfo cnt_tmp;
 
    //
-   // Temp file streams for continuous statistics
+   // Bootstrap statistics
    //
-   ofstream cnt_r_out;
-   ConcatString cnt_r_file, prefix;
+   BootStatTable cnt_r_tab;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -2065,363 +1986,349 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1) return;
 
    //
-   // Build the temp file names
+   // Allocate space to store the bootstrap statistics
    //
-   prefix << cs_erase << tmp_dir << "/tmp_cnt_r";
-   cnt_r_file = make_temp_file_name(prefix.c_str(), nullptr);
+   cnt_r_tab.set_size(b, n_cnt_boot);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   try {
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-      //
-      // Open up the temp files
-      //
-      cnt_r_out.open(cnt_r_file.c_str());
-      if(!cnt_r_out) {
-         mlog << Error << "\ncompute_cnt_stats_ci_perc() -> "
-              << "can't open the temporary file for writing:\n"
-              << cnt_r_file << "\n\n";
-         throw(1);
-      }
+   int rep_err = 0;
 
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
+#pragma omp parallel default(shared) private(i)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      CNTInfo rep_tmp = cnt_tmp;
 
-         ran_sample(rng_ptr, i_na, ir_na, m);
+#pragma omp for schedule (static)
+      for(i=0; i<b; i++) {
 
          //
-         // Compute continuous stats for each replicate with the
-         // rank_flag and normal_ci_flag unset
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
          //
-         compute_cntinfo(pd, ir_na, precip_flag, false, false, cnt_tmp);
-         write_cntinfo(cnt_r_out, cnt_tmp);
-      }
-
-      //
-      // Close the temp files
-      //
-      cnt_r_out.close();
-
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for fbar
-      //
-      s = cnt_info.fbar.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.fbar.v_bcl[i],
-                               cnt_info.fbar.v_bcu[i]);
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, m);
 
-      //
-      // Compute bootstrap interval for fstdev
-      //
-      s = cnt_info.fstdev.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.fstdev.v_bcl[i],
-                               cnt_info.fstdev.v_bcu[i]);
+            //
+            // Compute continuous stats for each replicate with the
+            // rank_flag and normal_ci_flag unset
+            //
+            compute_cntinfo(pd, ir_na, precip_flag, false, false, rep_tmp);
+            write_cntinfo(cnt_r_tab, i, rep_tmp);
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
+         }
+      }
 
-      //
-      // Compute bootstrap interval for obar
-      //
-      s = cnt_info.obar.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.obar.v_bcl[i],
-                               cnt_info.obar.v_bcu[i]);
+      gsl_rng_free(rep_rng);
 
-      //
-      // Compute bootstrap interval for ostdev
-      //
-      s = cnt_info.ostdev.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.ostdev.v_bcl[i],
-                               cnt_info.ostdev.v_bcu[i]);
+   } // end omp parallel
 
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_cnt_stats_ci_perc() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
 
-      //
-      // Compute bootstrap interval for pr_corr
-      //
-      s = cnt_info.pr_corr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.pr_corr.v_bcl[i],
-                               cnt_info.pr_corr.v_bcu[i]);
+   //
+   // Initialize column counter
+   //
+   c = 0;
 
-      //
-      // Compute bootstrap interval for anom_corr
-      //
-      s = cnt_info.anom_corr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.anom_corr.v_bcl[i],
-                               cnt_info.anom_corr.v_bcu[i]);
+   //
+   // Compute bootstrap interval for fbar
+   //
+   s = cnt_info.fbar.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.fbar.v_bcl[i],
+                            cnt_info.fbar.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for rmsfa
-      //
-      s = cnt_info.rmsfa.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.rmsfa.v_bcl[i],
-                               cnt_info.rmsfa.v_bcu[i]);
+   //
+   // Compute bootstrap interval for fstdev
+   //
+   s = cnt_info.fstdev.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.fstdev.v_bcl[i],
+                            cnt_info.fstdev.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for rmsoa
-      //
-      s = cnt_info.rmsoa.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.rmsoa.v_bcl[i],
-                               cnt_info.rmsoa.v_bcu[i]);
+   //
+   // Compute bootstrap interval for obar
+   //
+   s = cnt_info.obar.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.obar.v_bcl[i],
+                            cnt_info.obar.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for anom_corr_uncntr
-      //
-      s = cnt_info.anom_corr_uncntr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.anom_corr_uncntr.v_bcl[i],
-                               cnt_info.anom_corr_uncntr.v_bcu[i]);
+   //
+   // Compute bootstrap interval for ostdev
+   //
+   s = cnt_info.ostdev.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.ostdev.v_bcl[i],
+                            cnt_info.ostdev.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for me
-      //
-      s = cnt_info.me.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.me.v_bcl[i],
-                               cnt_info.me.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for me2
-      //
-      s = cnt_info.me2.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.me2.v_bcl[i],
-                               cnt_info.me2.v_bcu[i]);
+   //
+   // Compute bootstrap interval for pr_corr
+   //
+   s = cnt_info.pr_corr.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.pr_corr.v_bcl[i],
+                            cnt_info.pr_corr.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for estdev
-      //
-      s = cnt_info.estdev.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.estdev.v_bcl[i],
-                               cnt_info.estdev.v_bcu[i]);
+   //
+   // Compute bootstrap interval for anom_corr
+   //
+   s = cnt_info.anom_corr.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.anom_corr.v_bcl[i],
+                            cnt_info.anom_corr.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mbias
-      //
-      s = cnt_info.mbias.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.mbias.v_bcl[i],
-                               cnt_info.mbias.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmsfa
+   //
+   s = cnt_info.rmsfa.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.rmsfa.v_bcl[i],
+                            cnt_info.rmsfa.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mae
-      //
-      s = cnt_info.mae.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.mae.v_bcl[i],
-                               cnt_info.mae.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmsoa
+   //
+   s = cnt_info.rmsoa.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.rmsoa.v_bcl[i],
+                            cnt_info.rmsoa.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mse
-      //
-      s = cnt_info.mse.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.mse.v_bcl[i],
-                               cnt_info.mse.v_bcu[i]);
+   //
+   // Compute bootstrap interval for anom_corr_uncntr
+   //
+   s = cnt_info.anom_corr_uncntr.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.anom_corr_uncntr.v_bcl[i],
+                            cnt_info.anom_corr_uncntr.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for msess
-      //
-      s = cnt_info.msess.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.msess.v_bcl[i],
-                               cnt_info.msess.v_bcu[i]);
+   //
+   // Compute bootstrap interval for me
+   //
+   s = cnt_info.me.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.me.v_bcl[i],
+                            cnt_info.me.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for bcmse
-      //
-      s = cnt_info.bcmse.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.bcmse.v_bcl[i],
-                               cnt_info.bcmse.v_bcu[i]);
+   //
+   // Compute bootstrap interval for me2
+   //
+   s = cnt_info.me2.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.me2.v_bcl[i],
+                            cnt_info.me2.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for rmse
-      //
-      s = cnt_info.rmse.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.rmse.v_bcl[i],
-                               cnt_info.rmse.v_bcu[i]);
+   //
+   // Compute bootstrap interval for estdev
+   //
+   s = cnt_info.estdev.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.estdev.v_bcl[i],
+                            cnt_info.estdev.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for si
-      //
-      s = cnt_info.si.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.si.v_bcl[i],
-                               cnt_info.si.v_bcu[i]);
+   //
+   // Compute bootstrap interval for mbias
+   //
+   s = cnt_info.mbias.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.mbias.v_bcl[i],
+                            cnt_info.mbias.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e10
-      //
-      s = cnt_info.e10.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e10.v_bcl[i],
-                               cnt_info.e10.v_bcu[i]);
+   //
+   // Compute bootstrap interval for mae
+   //
+   s = cnt_info.mae.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.mae.v_bcl[i],
+                            cnt_info.mae.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e25
-      //
-      s = cnt_info.e25.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e25.v_bcl[i],
-                               cnt_info.e25.v_bcu[i]);
+   //
+   // Compute bootstrap interval for mse
+   //
+   s = cnt_info.mse.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.mse.v_bcl[i],
+                            cnt_info.mse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e50
-      //
-      s = cnt_info.e50.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e50.v_bcl[i],
-                               cnt_info.e50.v_bcu[i]);
+   //
+   // Compute bootstrap interval for msess
+   //
+   s = cnt_info.msess.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.msess.v_bcl[i],
+                            cnt_info.msess.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e75
-      //
-      s = cnt_info.e75.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e75.v_bcl[i],
-                               cnt_info.e75.v_bcu[i]);
+   //
+   // Compute bootstrap interval for bcmse
+   //
+   s = cnt_info.bcmse.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.bcmse.v_bcl[i],
+                            cnt_info.bcmse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for e90
-      //
-      s = cnt_info.e90.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.e90.v_bcl[i],
-                               cnt_info.e90.v_bcu[i]);
+   //
+   // Compute bootstrap interval for rmse
+   //
+   s = cnt_info.rmse.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.rmse.v_bcl[i],
+                            cnt_info.rmse.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for eiqr
-      //
-      s = cnt_info.eiqr.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.eiqr.v_bcl[i],
-                               cnt_info.eiqr.v_bcu[i]);
+   //
+   // Compute bootstrap interval for si
+   //
+   s = cnt_info.si.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.si.v_bcl[i],
+                            cnt_info.si.v_bcu[i]);
 
-      //
-      // Compute bootstrap interval for mad
-      //
-      s = cnt_info.mad.v;
-      read_ldf(cnt_r_file, c++, sr_na);
-      for(i=0; i<cnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                               cnt_info.alpha[i],
-                               cnt_info.mad.v_bcl[i],
-                               cnt_info.mad.v_bcu[i]);
-   } // end try block
+   //
+   // Compute bootstrap interval for e10
+   //
+   s = cnt_info.e10.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e10.v_bcl[i],
+                            cnt_info.e10.v_bcu[i]);
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for e25
    //
-   catch(int i_err) {
+   s = cnt_info.e25.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e25.v_bcl[i],
+                            cnt_info.e25.v_bcu[i]);
 
-      mlog << Error << "\ncompute_cnt_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   //
+   // Compute bootstrap interval for e50
+   //
+   s = cnt_info.e50.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e50.v_bcl[i],
+                            cnt_info.e50.v_bcu[i]);
 
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(cnt_r_file);
+   //
+   // Compute bootstrap interval for e75
+   //
+   s = cnt_info.e75.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e75.v_bcl[i],
+                            cnt_info.e75.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for e90
+   //
+   s = cnt_info.e90.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.e90.v_bcl[i],
+                            cnt_info.e90.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for eiqr
    //
-   remove_temp_file(cnt_r_file);
+   s = cnt_info.eiqr.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.eiqr.v_bcl[i],
+                            cnt_info.eiqr.v_bcu[i]);
 
+   //
+   // Compute bootstrap interval for mad
+   //
+   s = cnt_info.mad.v;
+   cnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<cnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                            cnt_info.alpha[i],
+                            cnt_info.mad.v_bcl[i],
+                            cnt_info.mad.v_bcu[i]);
    return;
 }
 
@@ -2430,19 +2337,19 @@ void compute_cnt_stats_ci_perc(const gsl_rng *rng_ptr,
 void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
                                  const PairDataPoint &pd,
                                  int b, NBRCTSInfo *&nbrcts_info,
-                                 int n_nbrcts, bool nbrcts_flag,
-                                 const char *tmp_dir) {
+                                 int n_nbrcts, bool nbrcts_flag) {
    int n = 0;
    int i, j, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
+   NumArray i_na, si_na, sr_na;
    NBRCTSInfo *nbrcts_tmp = (NBRCTSInfo *) 0;
 
    //
-   // Temp file streams for categorical statistics
+   // Bootstrap statistics for each threshold
    //
-   ofstream *nbrcts_i_out = (ofstream *) 0, *nbrcts_r_out = (ofstream *) 0;
-   ConcatString *nbrcts_i_file = (ConcatString *) 0, *nbrcts_r_file = (ConcatString *) 0, prefix;
+   BootStatTable *nbrcts_i_tab = (BootStatTable *) 0;
+   BootStatTable *nbrcts_r_tab = (BootStatTable *) 0;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -2478,388 +2385,343 @@ void compute_nbrcts_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcts_flag) return;
 
    //
-   // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // Allocate space to store categorical stats and the bootstrap
+   // statistics for each threshold
    //
-   nbrcts_tmp    = new NBRCTSInfo [n_nbrcts];
-   nbrcts_i_out  = new ofstream [n_nbrcts];
-   nbrcts_r_out  = new ofstream [n_nbrcts];
-   nbrcts_i_file = new ConcatString [n_nbrcts];
-   nbrcts_r_file = new ConcatString [n_nbrcts];
+   nbrcts_tmp   = new NBRCTSInfo [n_nbrcts];
+   nbrcts_i_tab = new BootStatTable [n_nbrcts];
+   nbrcts_r_tab = new BootStatTable [n_nbrcts];
    for(i=0; i<n_nbrcts; i++) {
       nbrcts_tmp[i].cts_info.fthresh = nbrcts_info[i].cts_info.fthresh;
       nbrcts_tmp[i].cts_info.othresh = nbrcts_info[i].cts_info.othresh;
       nbrcts_tmp[i].fthresh          = nbrcts_info[i].fthresh;
       nbrcts_tmp[i].othresh          = nbrcts_info[i].othresh;
       nbrcts_tmp[i].cthresh          = nbrcts_info[i].cthresh;
+      nbrcts_i_tab[i].set_size(n, n_cts_boot);
+      nbrcts_r_tab[i].set_size(b, n_cts_boot);
    }
 
    //
-   // Build the temp file names
+   // Compute catgegorical stats from the raw data with the i-th data
+   // point removed
    //
    for(i=0; i<n_nbrcts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_nbrcts_i_" << i;
-      nbrcts_i_file[i] = make_temp_file_name(prefix.c_str(), nullptr);
-
-      prefix << cs_erase << tmp_dir << "/tmp_nbrcts_r_" << i;
-      nbrcts_r_file[i] = make_temp_file_name(prefix.c_str(), nullptr);
-   }
+      for(j=0; j<n; j++) {
+         compute_i_ctsinfo(pd, j, false, nbrcts_tmp[i].cts_info);
+         write_ctsinfo(nbrcts_i_tab[i], j, nbrcts_tmp[i].cts_info);
+      }
+   } // end for i
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   try {
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-      //
-      // Open up the temp files
-      //
-      for(i=0; i<n_nbrcts; i++) {
-         nbrcts_i_out[i].open(nbrcts_i_file[i].c_str());
-         nbrcts_r_out[i].open(nbrcts_r_file[i].c_str());
-         if(!nbrcts_i_out[i] || !nbrcts_r_out[i]) {
-            mlog << Error << "\ncompute_nbrcts_stats_ci_bca() -> "
-                 << "can't open one or more temporary files for writing:\n"
-                 << nbrcts_i_file[i] << "\n"
-                 << nbrcts_r_file[i] << "\n\n";
+   int rep_err = 0;
+
+#pragma omp parallel default(shared) private(i, j)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      NBRCTSInfo *rep_tmp = new NBRCTSInfo [n_nbrcts];
+      for(j=0; j<n_nbrcts; j++) rep_tmp[j] = nbrcts_tmp[j];
+
+#pragma omp for schedule (static)
+      for(i=0; i<b; i++) {
+
+         //
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
+         //
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, n);
 
             //
-            // Attempt to delete temp files
+            // Compute categorical stats for each replicate with the
+            // nbrcts_flag set and the normal_ci_flag unset
             //
-            for(i=0; i<n_nbrcts; i++) {
-               remove_temp_file(nbrcts_i_file[i]);
-               remove_temp_file(nbrcts_r_file[i]);
-            }
-
-            // deallocate memory
-            if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-             if(nbrcts_i_out)  { delete [] nbrcts_i_out;  nbrcts_i_out  = (ofstream *)     0; }
-            if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-            if(nbrcts_i_file) { delete [] nbrcts_i_file; nbrcts_i_file = (ConcatString *) 0; }
-            if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
-
-            throw(1);
+            for(j=0; j<n_nbrcts; j++) {
+               compute_ctsinfo(pd, ir_na, true, false,
+                               rep_tmp[j].cts_info);
+               write_ctsinfo(nbrcts_r_tab[j], i, rep_tmp[j].cts_info);
+            } // end for j
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
          }
       }
 
-      //
-      // Compute catgegorical stats from the raw data with the i-th data
-      // point removed and write out to a temp file
-      //
-      for(i=0; i<n_nbrcts; i++) {
-         for(j=0; j<n; j++) {
-            compute_i_ctsinfo(pd, j, false, nbrcts_tmp[i].cts_info);
-            write_ctsinfo(nbrcts_i_out[i], nbrcts_tmp[i].cts_info);
-         }
-      } // end for i
+      if(rep_tmp) { delete [] rep_tmp; rep_tmp = (NBRCTSInfo *) 0; }
+      gsl_rng_free(rep_rng);
 
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
+   } // end omp parallel
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_nbrcts_stats_ci_bca() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
 
-         //
-         // Compute categorical stats for each replicate with the
-         // nbrcts_flag flag set and the normal_ci_flag unset
-         //
-         for(j=0; j<n_nbrcts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false,
-                            nbrcts_tmp[j].cts_info);
-            write_ctsinfo(nbrcts_r_out[j], nbrcts_tmp[j].cts_info);
-         } // end for j
-      }
+   //
+   // Compute bootstrap intervals for each threshold value
+   //
+   for(i=0; i<n_nbrcts; i++) {
 
       //
-      // Close the temp files
+      // Initialize column counter
       //
-      for(i=0; i<n_nbrcts; i++) {
-         nbrcts_i_out[i].close();
-         nbrcts_r_out[i].close();
-      }
+      c = 0;
 
       //
-      // Compute bootstrap intervals for each threshold value
+      // Compute bootstrap interval for baser
       //
-      for(i=0; i<n_nbrcts; i++) {
-
-         //
-         // Initialize column counter
-         //
-         c = 1;
-
-         //
-         // Compute bootstrap interval for baser
-         //
-         s = nbrcts_info[i].cts_info.baser.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.baser.v_bcl[j],
-                                 nbrcts_info[i].cts_info.baser.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fmean
-         //
-         s = nbrcts_info[i].cts_info.fmean.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.fmean.v_bcl[j],
-                                 nbrcts_info[i].cts_info.fmean.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for acc
-         //
-         s = nbrcts_info[i].cts_info.acc.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.acc.v_bcl[j],
-                                 nbrcts_info[i].cts_info.acc.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fbias
-         //
-         s = nbrcts_info[i].cts_info.fbias.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.fbias.v_bcl[j],
-                                 nbrcts_info[i].cts_info.fbias.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pody
-         //
-         s = nbrcts_info[i].cts_info.pody.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.pody.v_bcl[j],
-                                 nbrcts_info[i].cts_info.pody.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for podn
-         //
-         s = nbrcts_info[i].cts_info.podn.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.podn.v_bcl[j],
-                                 nbrcts_info[i].cts_info.podn.v_bcu[j]);
+      s = nbrcts_info[i].cts_info.baser.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.baser.v_bcl[j],
+                              nbrcts_info[i].cts_info.baser.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for pofd
-         //
-         s = nbrcts_info[i].cts_info.pofd.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.pofd.v_bcl[j],
-                                 nbrcts_info[i].cts_info.pofd.v_bcu[j]);
+      //
+      // Compute bootstrap interval for fmean
+      //
+      s = nbrcts_info[i].cts_info.fmean.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.fmean.v_bcl[j],
+                              nbrcts_info[i].cts_info.fmean.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for far
-         //
-         s = nbrcts_info[i].cts_info.far.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.far.v_bcl[j],
-                                 nbrcts_info[i].cts_info.far.v_bcu[j]);
+      //
+      // Compute bootstrap interval for acc
+      //
+      s = nbrcts_info[i].cts_info.acc.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.acc.v_bcl[j],
+                              nbrcts_info[i].cts_info.acc.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for csi
-         //
-         s = nbrcts_info[i].cts_info.csi.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.csi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.csi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for fbias
+      //
+      s = nbrcts_info[i].cts_info.fbias.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.fbias.v_bcl[j],
+                              nbrcts_info[i].cts_info.fbias.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for gss
-         //
-         s = nbrcts_info[i].cts_info.gss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.gss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.gss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for pody
+      //
+      s = nbrcts_info[i].cts_info.pody.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.pody.v_bcl[j],
+                              nbrcts_info[i].cts_info.pody.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hk
-         //
-         s = nbrcts_info[i].cts_info.hk.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.hk.v_bcl[j],
-                                 nbrcts_info[i].cts_info.hk.v_bcu[j]);
+      //
+      // Compute bootstrap interval for podn
+      //
+      s = nbrcts_info[i].cts_info.podn.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.podn.v_bcl[j],
+                              nbrcts_info[i].cts_info.podn.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hss
-         //
-         s = nbrcts_info[i].cts_info.hss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.hss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.hss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for pofd
+      //
+      s = nbrcts_info[i].cts_info.pofd.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.pofd.v_bcl[j],
+                              nbrcts_info[i].cts_info.pofd.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for odds
-         //
-         s = nbrcts_info[i].cts_info.odds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.odds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.odds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for far
+      //
+      s = nbrcts_info[i].cts_info.far.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.far.v_bcl[j],
+                              nbrcts_info[i].cts_info.far.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for lodds
-         //
-         s = nbrcts_info[i].cts_info.lodds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.lodds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.lodds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for csi
+      //
+      s = nbrcts_info[i].cts_info.csi.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.csi.v_bcl[j],
+                              nbrcts_info[i].cts_info.csi.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for orss
-         //
-         s = nbrcts_info[i].cts_info.orss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.orss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.orss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for gss
+      //
+      s = nbrcts_info[i].cts_info.gss.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.gss.v_bcl[j],
+                              nbrcts_info[i].cts_info.gss.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for eds
-         //
-         s = nbrcts_info[i].cts_info.eds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.eds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.eds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hk
+      //
+      s = nbrcts_info[i].cts_info.hk.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.hk.v_bcl[j],
+                              nbrcts_info[i].cts_info.hk.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for seds
-         //
-         s = nbrcts_info[i].cts_info.seds.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.seds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.seds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hss
+      //
+      s = nbrcts_info[i].cts_info.hss.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.hss.v_bcl[j],
+                              nbrcts_info[i].cts_info.hss.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for edi
-         //
-         s = nbrcts_info[i].cts_info.edi.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.edi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.edi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for odds
+      //
+      s = nbrcts_info[i].cts_info.odds.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.odds.v_bcl[j],
+                              nbrcts_info[i].cts_info.odds.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for sedi
-         //
-         s = nbrcts_info[i].cts_info.sedi.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.sedi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.sedi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for lodds
+      //
+      s = nbrcts_info[i].cts_info.lodds.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.lodds.v_bcl[j],
+                              nbrcts_info[i].cts_info.lodds.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for bagss
-         //
-         s = nbrcts_info[i].cts_info.bagss.v;
-         read_ldf(nbrcts_i_file[i], c,   si_na);
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_bca_interval(s, si_na, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.bagss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.bagss.v_bcu[j]);
-      } // end for i
+      //
+      // Compute bootstrap interval for orss
+      //
+      s = nbrcts_info[i].cts_info.orss.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.orss.v_bcl[j],
+                              nbrcts_info[i].cts_info.orss.v_bcu[j]);
 
-   } // end try block
+      //
+      // Compute bootstrap interval for eds
+      //
+      s = nbrcts_info[i].cts_info.eds.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.eds.v_bcl[j],
+                              nbrcts_info[i].cts_info.eds.v_bcu[j]);
 
-   //
-   // Catch any thrown errors
-   //
-   catch(int i_err) {
+      //
+      // Compute bootstrap interval for seds
+      //
+      s = nbrcts_info[i].cts_info.seds.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.seds.v_bcl[j],
+                              nbrcts_info[i].cts_info.seds.v_bcu[j]);
 
-      mlog << Error << "\ncompute_nbrcts_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+      //
+      // Compute bootstrap interval for edi
+      //
+      s = nbrcts_info[i].cts_info.edi.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.edi.v_bcl[j],
+                              nbrcts_info[i].cts_info.edi.v_bcu[j]);
 
-      exit(i_err);
-   } // end catch block
+      //
+      // Compute bootstrap interval for sedi
+      //
+      s = nbrcts_info[i].cts_info.sedi.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.sedi.v_bcl[j],
+                              nbrcts_info[i].cts_info.sedi.v_bcu[j]);
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_nbrcts; i++) {
-      remove_temp_file(nbrcts_i_file[i]);
-      remove_temp_file(nbrcts_r_file[i]);
-   }
+      //
+      // Compute bootstrap interval for bagss
+      //
+      s = nbrcts_info[i].cts_info.bagss.v;
+      nbrcts_i_tab[i].get_col(c,   si_na);
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_bca_interval(s, si_na, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.bagss.v_bcl[j],
+                              nbrcts_info[i].cts_info.bagss.v_bcu[j]);
+   } // end for i
 
    //
    // Deallocate memory
    //
-   if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-   if(nbrcts_i_out)  { delete [] nbrcts_i_out;  nbrcts_i_out  = (ofstream *)     0; }
-   if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-   if(nbrcts_i_file) { delete [] nbrcts_i_file; nbrcts_i_file = (ConcatString *) 0; }
-   if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
+   if(nbrcts_tmp)   { delete [] nbrcts_tmp;   nbrcts_tmp   = (NBRCTSInfo *)    0; }
+   if(nbrcts_i_tab) { delete [] nbrcts_i_tab; nbrcts_i_tab = (BootStatTable *) 0; }
+   if(nbrcts_r_tab) { delete [] nbrcts_r_tab; nbrcts_r_tab = (BootStatTable *) 0; }
 
    return;
 }
@@ -2870,19 +2732,18 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
                                  const PairDataPoint &pd,
                                  const PairDataPoint &pd_thr,
                                  int b, NBRCNTInfo &nbrcnt_info,
-                                 bool nbrcnt_flag,
-                                 const char *tmp_dir) {
+                                 bool nbrcnt_flag) {
    int n = 0;
    int i, c;
    double s;
-   NumArray i_na, ir_na, si_na, sr_na;
+   NumArray i_na, si_na, sr_na;
    NBRCNTInfo nbrcnt_tmp;
 
    //
-   // Temp file streams for continuous statistics
+   // Bootstrap statistics
    //
-   ofstream nbrcnt_i_out, nbrcnt_r_out;
-   ConcatString nbrcnt_i_file, nbrcnt_r_file, prefix;
+   BootStatTable nbrcnt_i_tab, nbrcnt_r_tab;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -2914,164 +2775,143 @@ void compute_nbrcnt_stats_ci_bca(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcnt_flag) return;
 
    //
-   // Build the temp file names
+   // Allocate space to store the bootstrap statistics
    //
-   prefix << cs_erase << tmp_dir << "/tmp_nbrcnt_i";
-   nbrcnt_i_file = make_temp_file_name(prefix.c_str(), nullptr);
+   nbrcnt_i_tab.set_size(n, n_nbrcnt_boot);
+   nbrcnt_r_tab.set_size(b, n_nbrcnt_boot);
 
-   prefix << cs_erase << tmp_dir << "/tmp_nbrcnt_r";
-   nbrcnt_r_file = make_temp_file_name(prefix.c_str(), nullptr);
+   //
+   // Compute continuous stats from the raw data with the i-th data
+   // point removed
+   //
+   for(i=0; i<n; i++) {
+      compute_i_nbrcntinfo(pd, pd_thr, i, nbrcnt_tmp);
+      write_nbrcntinfo(nbrcnt_i_tab, i, nbrcnt_tmp);
+   }
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   try {
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-      //
-      // Open up the temp files
-      //
-      nbrcnt_i_out.open(nbrcnt_i_file.c_str());
-      nbrcnt_r_out.open(nbrcnt_r_file.c_str());
-      if(!nbrcnt_i_out || !nbrcnt_r_out) {
-         mlog << Error << "\ncompute_nbrcnt_stats_ci_bca() -> "
-              << "can't open one or more temporary files for writing:\n"
-              << nbrcnt_i_file << "\n"
-              << nbrcnt_r_file << "\n\n";
-         throw(1);
-      }
+   int rep_err = 0;
 
-      //
-      // Compute continuous stats from the raw data with the i-th data
-      // point removed and write out to a temp file
-      //
-      for(i=0; i<n; i++) {
-         compute_i_nbrcntinfo(pd, pd_thr, i, nbrcnt_tmp);
-         write_nbrcntinfo(nbrcnt_i_out, nbrcnt_tmp);
-      }
+#pragma omp parallel default(shared) private(i)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      NBRCNTInfo rep_tmp = nbrcnt_tmp;
 
-      //
-      // Resample the array of indices with replacement
-      //
+#pragma omp for schedule (static)
       for(i=0; i<b; i++) {
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
-
          //
-         // Compute continuous stats for each replicate
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
          //
-         compute_nbrcntinfo(pd, pd_thr, ir_na, nbrcnt_tmp, 1);
-         write_nbrcntinfo(nbrcnt_r_out, nbrcnt_tmp);
-      }
-
-      //
-      // Close the temp files
-      //
-      nbrcnt_i_out.close();
-      nbrcnt_r_out.close();
-
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for FBS
-      //
-      s = nbrcnt_info.fbs.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.fbs.v_bcl[i],
-                              nbrcnt_info.fbs.v_bcu[i]);
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, n);
 
-      //
-      // Compute bootstrap interval for FSS
-      //
-      s = nbrcnt_info.fss.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.fss.v_bcl[i],
-                              nbrcnt_info.fss.v_bcu[i]);
+            //
+            // Compute continuous stats for each replicate
+            //
+            compute_nbrcntinfo(pd, pd_thr, ir_na, rep_tmp, 1);
+            write_nbrcntinfo(nbrcnt_r_tab, i, rep_tmp);
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
+         }
+      }
 
-      //
-      // Compute bootstrap interval for AFSS
-      //
-      s = nbrcnt_info.afss.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.afss.v_bcl[i],
-                              nbrcnt_info.afss.v_bcu[i]);
+      gsl_rng_free(rep_rng);
 
-      //
-      // Compute bootstrap interval for UFSS
-      //
-      s = nbrcnt_info.ufss.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.ufss.v_bcl[i],
-                              nbrcnt_info.ufss.v_bcu[i]);
+   } // end omp parallel
 
-      //
-      // Compute bootstrap interval for F_RATE
-      //
-      s = nbrcnt_info.f_rate.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.f_rate.v_bcl[i],
-                              nbrcnt_info.f_rate.v_bcu[i]);
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_nbrcnt_stats_ci_bca() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
 
-      //
-      // Compute bootstrap interval for O_RATE
-      //
-      s = nbrcnt_info.o_rate.v;
-      read_ldf(nbrcnt_i_file, c,   si_na);
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_bca_interval(s, si_na, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.o_rate.v_bcl[i],
-                              nbrcnt_info.o_rate.v_bcu[i]);
+   //
+   // Initialize column counter
+   //
+   c = 0;
 
-   } // end try block
+   //
+   // Compute bootstrap interval for FBS
+   //
+   s = nbrcnt_info.fbs.v;
+   nbrcnt_i_tab.get_col(c,   si_na);
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.fbs.v_bcl[i],
+                           nbrcnt_info.fbs.v_bcu[i]);
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for FSS
    //
-   catch(int i_err) {
+   s = nbrcnt_info.fss.v;
+   nbrcnt_i_tab.get_col(c,   si_na);
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.fss.v_bcl[i],
+                           nbrcnt_info.fss.v_bcu[i]);
 
-      mlog << Error << "\ncompute_nbrcnt_stats_ci_bca() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   //
+   // Compute bootstrap interval for AFSS
+   //
+   s = nbrcnt_info.afss.v;
+   nbrcnt_i_tab.get_col(c,   si_na);
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.afss.v_bcl[i],
+                           nbrcnt_info.afss.v_bcu[i]);
 
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(nbrcnt_i_file);
-      remove_temp_file(nbrcnt_r_file);
+   //
+   // Compute bootstrap interval for UFSS
+   //
+   s = nbrcnt_info.ufss.v;
+   nbrcnt_i_tab.get_col(c,   si_na);
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.ufss.v_bcl[i],
+                           nbrcnt_info.ufss.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for F_RATE
+   //
+   s = nbrcnt_info.f_rate.v;
+   nbrcnt_i_tab.get_col(c,   si_na);
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.f_rate.v_bcl[i],
+                           nbrcnt_info.f_rate.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for O_RATE
    //
-   remove_temp_file(nbrcnt_i_file);
-   remove_temp_file(nbrcnt_r_file);
+   s = nbrcnt_info.o_rate.v;
+   nbrcnt_i_tab.get_col(c,   si_na);
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_bca_interval(s, si_na, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.o_rate.v_bcl[i],
+                           nbrcnt_info.o_rate.v_bcu[i]);
 
    return;
 }
@@ -3082,19 +2922,18 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
                                   const PairDataPoint &pd,
                                   int b, double m_prop,
                                   NBRCTSInfo *&nbrcts_info,
-                                  int n_nbrcts, bool nbrcts_flag,
-                                  const char *tmp_dir) {
+                                  int n_nbrcts, bool nbrcts_flag) {
    int n = 0;
    int i, j, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
+   NumArray i_na, sr_na;
    NBRCTSInfo *nbrcts_tmp = ( NBRCTSInfo *) 0;
 
    //
-   // Temp file streams for categorical statistics
+   // Bootstrap statistics for each threshold
    //
-   ofstream *nbrcts_r_out = (ofstream *) 0;
-   ConcatString *nbrcts_r_file = (ConcatString *) 0, prefix;
+   BootStatTable *nbrcts_r_tab = (BootStatTable *) 0;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -3130,339 +2969,309 @@ void compute_nbrcts_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcts_flag) return;
 
    //
-   // Allocate space to store categorical stats for each threshold
-   // and for the output temp file streams
+   // Allocate space to store categorical stats and the bootstrap
+   // statistics for each threshold
    //
-   nbrcts_tmp    = new NBRCTSInfo [n_nbrcts];
-   nbrcts_r_out  = new ofstream [n_nbrcts];
-   nbrcts_r_file = new ConcatString [n_nbrcts];
+   nbrcts_tmp   = new NBRCTSInfo [n_nbrcts];
+   nbrcts_r_tab = new BootStatTable [n_nbrcts];
    for(i=0; i<n_nbrcts; i++) {
       nbrcts_tmp[i].cts_info.fthresh = nbrcts_info[i].cts_info.fthresh;
       nbrcts_tmp[i].cts_info.othresh = nbrcts_info[i].cts_info.othresh;
       nbrcts_tmp[i].fthresh          = nbrcts_info[i].fthresh;
       nbrcts_tmp[i].othresh          = nbrcts_info[i].othresh;
       nbrcts_tmp[i].cthresh          = nbrcts_info[i].cthresh;
+      nbrcts_r_tab[i].set_size(b, n_cts_boot);
    }
 
    //
-   // Build the temp file names
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   for(i=0; i<n_nbrcts; i++) {
-      prefix << cs_erase << tmp_dir << "/tmp_nbrcts_r_" << i;
-      nbrcts_r_file[i] = make_temp_file_name(prefix.c_str(), nullptr);
-   }
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-   //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
-   //
-   try {
+   int rep_err = 0;
 
-      //
-      // Open up the temp files
-      //
-      for(i=0; i<n_nbrcts; i++) {
-         nbrcts_r_out[i].open(nbrcts_r_file[i].c_str());
-         if(!nbrcts_r_out[i]) {
-            mlog << Error << "\ncompute_nbrcts_stats_ci_perc() -> "
-                 << "can't open the temporary file for writing:\n"
-                 << nbrcts_r_file[i] << "\n\n";
+#pragma omp parallel default(shared) private(i, j)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      NBRCTSInfo *rep_tmp = new NBRCTSInfo [n_nbrcts];
+      for(j=0; j<n_nbrcts; j++) rep_tmp[j] = nbrcts_tmp[j];
 
-            //
-          // Attempt to delete temp files
-          //
-          for(i=0; i<n_nbrcts; i++) remove_temp_file(nbrcts_r_file[i]);
-         // Deallocate memory
+#pragma omp for schedule (static)
+      for(i=0; i<b; i++) {
+
+         //
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
          //
-         if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-         if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-         if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, n);
 
-            throw(1);
+            //
+            // Compute categorical stats for each replicate with the
+            // nbrcts_flag set and the normal_ci_flag unset
+            //
+            for(j=0; j<n_nbrcts; j++) {
+               compute_ctsinfo(pd, ir_na, true, false,
+                               rep_tmp[j].cts_info);
+               write_ctsinfo(nbrcts_r_tab[j], i, rep_tmp[j].cts_info);
+            } // end for j
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
          }
       }
 
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
+      if(rep_tmp) { delete [] rep_tmp; rep_tmp = (NBRCTSInfo *) 0; }
+      gsl_rng_free(rep_rng);
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+   } // end omp parallel
 
-         //
-         // Compute categorical stats for each replicate with the
-         // nbrcts_flag set and the normal_ci_flag unset
-         //
-         for(j=0; j<n_nbrcts; j++) {
-            compute_ctsinfo(pd, ir_na, true, false,
-                            nbrcts_tmp[j].cts_info);
-            write_ctsinfo(nbrcts_r_out[j], nbrcts_tmp[j].cts_info);
-         } // end for j
-      }
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_nbrcts_stats_ci_perc() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
+
+   //
+   // Compute bootstrap intervals for each threshold value
+   //
+   for(i=0; i<n_nbrcts; i++) {
 
       //
-      // Close the temp files
+      // Initialize column counter
       //
-      for(i=0; i<n_nbrcts; i++) nbrcts_r_out[i].close();
+      c = 0;
 
       //
-      // Compute bootstrap intervals for each threshold value
+      // Compute bootstrap interval for baser
       //
-      for(i=0; i<n_nbrcts; i++) {
-
-         //
-         // Initialize column counter
-         //
-         c = 1;
-
-         //
-         // Compute bootstrap interval for baser
-         //
-         s = nbrcts_info[i].cts_info.baser.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.baser.v_bcl[j],
-                                  nbrcts_info[i].cts_info.baser.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fmean
-         //
-         s = nbrcts_info[i].cts_info.fmean.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.fmean.v_bcl[j],
-                                  nbrcts_info[i].cts_info.fmean.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for acc
-         //
-         s = nbrcts_info[i].cts_info.acc.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.acc.v_bcl[j],
-                                  nbrcts_info[i].cts_info.acc.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for fbias
-         //
-         s = nbrcts_info[i].cts_info.fbias.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.fbias.v_bcl[j],
-                                  nbrcts_info[i].cts_info.fbias.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for pody
-         //
-         s = nbrcts_info[i].cts_info.pody.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.pody.v_bcl[j],
-                                  nbrcts_info[i].cts_info.pody.v_bcu[j]);
-
-         //
-         // Compute bootstrap interval for podn
-         //
-         s = nbrcts_info[i].cts_info.podn.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.podn.v_bcl[j],
-                                  nbrcts_info[i].cts_info.podn.v_bcu[j]);
+      s = nbrcts_info[i].cts_info.baser.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.baser.v_bcl[j],
+                               nbrcts_info[i].cts_info.baser.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for pofd
-         //
-         s = nbrcts_info[i].cts_info.pofd.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.pofd.v_bcl[j],
-                                  nbrcts_info[i].cts_info.pofd.v_bcu[j]);
+      //
+      // Compute bootstrap interval for fmean
+      //
+      s = nbrcts_info[i].cts_info.fmean.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.fmean.v_bcl[j],
+                               nbrcts_info[i].cts_info.fmean.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for far
-         //
-         s = nbrcts_info[i].cts_info.far.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.far.v_bcl[j],
-                                  nbrcts_info[i].cts_info.far.v_bcu[j]);
+      //
+      // Compute bootstrap interval for acc
+      //
+      s = nbrcts_info[i].cts_info.acc.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.acc.v_bcl[j],
+                               nbrcts_info[i].cts_info.acc.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for csi
-         //
-         s = nbrcts_info[i].cts_info.csi.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.csi.v_bcl[j],
-                                  nbrcts_info[i].cts_info.csi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for fbias
+      //
+      s = nbrcts_info[i].cts_info.fbias.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.fbias.v_bcl[j],
+                               nbrcts_info[i].cts_info.fbias.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for gss
-         //
-         s = nbrcts_info[i].cts_info.gss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.gss.v_bcl[j],
-                                  nbrcts_info[i].cts_info.gss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for pody
+      //
+      s = nbrcts_info[i].cts_info.pody.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.pody.v_bcl[j],
+                               nbrcts_info[i].cts_info.pody.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hk
-         //
-         s = nbrcts_info[i].cts_info.hk.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.hk.v_bcl[j],
-                                  nbrcts_info[i].cts_info.hk.v_bcu[j]);
+      //
+      // Compute bootstrap interval for podn
+      //
+      s = nbrcts_info[i].cts_info.podn.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.podn.v_bcl[j],
+                               nbrcts_info[i].cts_info.podn.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for hss
-         //
-         s = nbrcts_info[i].cts_info.hss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.hss.v_bcl[j],
-                                  nbrcts_info[i].cts_info.hss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for pofd
+      //
+      s = nbrcts_info[i].cts_info.pofd.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.pofd.v_bcl[j],
+                               nbrcts_info[i].cts_info.pofd.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for odds
-         //
-         s = nbrcts_info[i].cts_info.odds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                  nbrcts_info[i].cts_info.alpha[j],
-                                  nbrcts_info[i].cts_info.odds.v_bcl[j],
-                                  nbrcts_info[i].cts_info.odds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for far
+      //
+      s = nbrcts_info[i].cts_info.far.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.far.v_bcl[j],
+                               nbrcts_info[i].cts_info.far.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for lodds
-         //
-         s = nbrcts_info[i].cts_info.lodds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.lodds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.lodds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for csi
+      //
+      s = nbrcts_info[i].cts_info.csi.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.csi.v_bcl[j],
+                               nbrcts_info[i].cts_info.csi.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for orss
-         //
-         s = nbrcts_info[i].cts_info.orss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.orss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.orss.v_bcu[j]);
+      //
+      // Compute bootstrap interval for gss
+      //
+      s = nbrcts_info[i].cts_info.gss.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.gss.v_bcl[j],
+                               nbrcts_info[i].cts_info.gss.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for eds
-         //
-         s = nbrcts_info[i].cts_info.eds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.eds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.eds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hk
+      //
+      s = nbrcts_info[i].cts_info.hk.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.hk.v_bcl[j],
+                               nbrcts_info[i].cts_info.hk.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for seds
-         //
-         s = nbrcts_info[i].cts_info.seds.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.seds.v_bcl[j],
-                                 nbrcts_info[i].cts_info.seds.v_bcu[j]);
+      //
+      // Compute bootstrap interval for hss
+      //
+      s = nbrcts_info[i].cts_info.hss.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.hss.v_bcl[j],
+                               nbrcts_info[i].cts_info.hss.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for edi
-         //
-         s = nbrcts_info[i].cts_info.edi.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.edi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.edi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for odds
+      //
+      s = nbrcts_info[i].cts_info.odds.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                               nbrcts_info[i].cts_info.alpha[j],
+                               nbrcts_info[i].cts_info.odds.v_bcl[j],
+                               nbrcts_info[i].cts_info.odds.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for sedi
-         //
-         s = nbrcts_info[i].cts_info.sedi.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.sedi.v_bcl[j],
-                                 nbrcts_info[i].cts_info.sedi.v_bcu[j]);
+      //
+      // Compute bootstrap interval for lodds
+      //
+      s = nbrcts_info[i].cts_info.lodds.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.lodds.v_bcl[j],
+                              nbrcts_info[i].cts_info.lodds.v_bcu[j]);
 
-         //
-         // Compute bootstrap interval for bagss
-         //
-         s = nbrcts_info[i].cts_info.bagss.v;
-         read_ldf(nbrcts_r_file[i], c++, sr_na);
-         for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
-            compute_perc_interval(s, sr_na,
-                                 nbrcts_info[i].cts_info.alpha[j],
-                                 nbrcts_info[i].cts_info.bagss.v_bcl[j],
-                                 nbrcts_info[i].cts_info.bagss.v_bcu[j]);
-      } // end for i
+      //
+      // Compute bootstrap interval for orss
+      //
+      s = nbrcts_info[i].cts_info.orss.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.orss.v_bcl[j],
+                              nbrcts_info[i].cts_info.orss.v_bcu[j]);
 
-   } // end try block
+      //
+      // Compute bootstrap interval for eds
+      //
+      s = nbrcts_info[i].cts_info.eds.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.eds.v_bcl[j],
+                              nbrcts_info[i].cts_info.eds.v_bcu[j]);
 
-   //
-   // Catch any thrown errors
-   //
-   catch(int i_err) {
+      //
+      // Compute bootstrap interval for seds
+      //
+      s = nbrcts_info[i].cts_info.seds.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.seds.v_bcl[j],
+                              nbrcts_info[i].cts_info.seds.v_bcu[j]);
 
-      mlog << Error << "\ncompute_nbrcts_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+      //
+      // Compute bootstrap interval for edi
+      //
+      s = nbrcts_info[i].cts_info.edi.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.edi.v_bcl[j],
+                              nbrcts_info[i].cts_info.edi.v_bcu[j]);
 
-      exit(i_err);
-   } // end catch block
+      //
+      // Compute bootstrap interval for sedi
+      //
+      s = nbrcts_info[i].cts_info.sedi.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.sedi.v_bcl[j],
+                              nbrcts_info[i].cts_info.sedi.v_bcu[j]);
 
-   //
-   // Delete temp files
-   //
-   for(i=0; i<n_nbrcts; i++) {
-      remove_temp_file(nbrcts_r_file[i]);
-   }
+      //
+      // Compute bootstrap interval for bagss
+      //
+      s = nbrcts_info[i].cts_info.bagss.v;
+      nbrcts_r_tab[i].get_col(c++, sr_na);
+      for(j=0; j<nbrcts_info[i].cts_info.n_alpha; j++)
+         compute_perc_interval(s, sr_na,
+                              nbrcts_info[i].cts_info.alpha[j],
+                              nbrcts_info[i].cts_info.bagss.v_bcl[j],
+                              nbrcts_info[i].cts_info.bagss.v_bcu[j]);
+   } // end for i
 
    //
    // Deallocate memory
    //
-   if(nbrcts_tmp)    { delete [] nbrcts_tmp;    nbrcts_tmp    = (NBRCTSInfo *)   0; }
-   if(nbrcts_r_out)  { delete [] nbrcts_r_out;  nbrcts_r_out  = (ofstream *)     0; }
-   if(nbrcts_r_file) { delete [] nbrcts_r_file; nbrcts_r_file = (ConcatString *) 0; }
+   if(nbrcts_tmp)   { delete [] nbrcts_tmp;   nbrcts_tmp   = (NBRCTSInfo *)    0; }
+   if(nbrcts_r_tab) { delete [] nbrcts_r_tab; nbrcts_r_tab = (BootStatTable *) 0; }
 
    return;
 }
@@ -3474,19 +3283,18 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
                                   const PairDataPoint &pd_thr,
                                   int b, double m_prop,
                                   NBRCNTInfo &nbrcnt_info,
-                                  bool nbrcnt_flag,
-                                  const char *tmp_dir) {
+                                  bool nbrcnt_flag) {
    int n = 0;
    int i, c;
    double s;
-   NumArray i_na, ir_na, sr_na;
+   NumArray i_na, sr_na;
    NBRCNTInfo nbrcnt_tmp;
 
    //
-   // Temp file streams for continuous statistics
+   // Bootstrap statistics
    //
-   ofstream nbrcnt_r_out;
-   ConcatString nbrcnt_r_file, prefix;
+   BootStatTable nbrcnt_r_tab;
+   vector<unsigned long> rep_seed;
 
    //
    // Check that the forecast and observation arrays of the same length
@@ -3518,141 +3326,127 @@ void compute_nbrcnt_stats_ci_perc(const gsl_rng *rng_ptr,
    if(n<=1 || b<1 || !nbrcnt_flag) return;
 
    //
-   // Build the temp file names
+   // Allocate space to store the bootstrap statistics
    //
-   prefix << cs_erase << tmp_dir << "/tmp_nbrcnt_r";
-   nbrcnt_r_file = make_temp_file_name(prefix.c_str(), nullptr);
+   nbrcnt_r_tab.set_size(b, n_nbrcnt_boot);
 
    //
-   // Enclose computations in a try block to catch any errors and
-   // delete the temp files before exiting
+   // Resample the array of indices with replacement.  Replicates are
+   // computed in parallel, each using its own random number seed.
    //
-   try {
+   draw_rep_seeds(rng_ptr, b, rep_seed);
 
-      //
-      // Open up the temp files
-      //
-      nbrcnt_r_out.open(nbrcnt_r_file.c_str());
-      if(!nbrcnt_r_out) {
-         mlog << Error << "\ncompute_nbrcnt_stats_ci_perc() -> "
-              << "can't open the temporary file for writing:\n"
-              << nbrcnt_r_file << "\n\n";
-         throw(1);
-      }
+   int rep_err = 0;
 
-      //
-      // Resample the array of indices with replacement
-      //
-      for(i=0; i<b; i++) {
+#pragma omp parallel default(shared) private(i)
+   {
+      gsl_rng *rep_rng = gsl_rng_clone(rng_ptr);
+      NumArray ir_na;
+      NBRCNTInfo rep_tmp = nbrcnt_tmp;
 
-         ran_sample(rng_ptr, i_na, ir_na, n);
+#pragma omp for schedule (static)
+      for(i=0; i<b; i++) {
 
          //
-         // Compute continuous stats for each replicate
+         // Errors thrown inside a parallel region must be caught
+         // there and reported after the region completes
          //
-         compute_nbrcntinfo(pd, pd_thr, ir_na, nbrcnt_tmp, 1);
-         write_nbrcntinfo(nbrcnt_r_out, nbrcnt_tmp);
-      }
-
-      //
-      // Close the temp files
-      //
-      nbrcnt_r_out.close();
-
-      //
-      // Initialize column counter
-      //
-      c = 1;
-
-      //
-      // Compute bootstrap interval for FBS
-      //
-      s = nbrcnt_info.fbs.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.fbs.v_bcl[i],
-                              nbrcnt_info.fbs.v_bcu[i]);
+         try {
+            ran_sample_rep(rep_rng, rep_seed[i], i_na, ir_na, n);
 
-      //
-      // Compute bootstrap interval for FSS
-      //
-      s = nbrcnt_info.fss.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.fss.v_bcl[i],
-                              nbrcnt_info.fss.v_bcu[i]);
+            //
+            // Compute continuous stats for each replicate
+            //
+            compute_nbrcntinfo(pd, pd_thr, ir_na, rep_tmp, 1);
+            write_nbrcntinfo(nbrcnt_r_tab, i, rep_tmp);
+         }
+         catch(int i_err) {
+#pragma omp critical(compute_ci_rep_err)
+            rep_err = i_err;
+         }
+      }
 
-      //
-      // Compute bootstrap interval for AFSS
-      //
-      s = nbrcnt_info.afss.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.afss.v_bcl[i],
-                              nbrcnt_info.afss.v_bcu[i]);
+      gsl_rng_free(rep_rng);
 
-      //
-      // Compute bootstrap interval for UFSS
-      //
-      s = nbrcnt_info.ufss.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.ufss.v_bcl[i],
-                              nbrcnt_info.ufss.v_bcu[i]);
+   } // end omp parallel
 
-      //
-      // Compute bootstrap interval for F_RATE
-      //
-      s = nbrcnt_info.f_rate.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.f_rate.v_bcl[i],
-                              nbrcnt_info.f_rate.v_bcu[i]);
+   if(rep_err != 0) {
+      mlog << Error << "\ncompute_nbrcnt_stats_ci_perc() -> "
+           << "encountered an error value of " << rep_err
+           << " while computing bootstrap replicates.\n\n";
+      exit(rep_err);
+   }
 
-      //
-      // Compute bootstrap interval for O_RATE
-      //
-      s = nbrcnt_info.o_rate.v;
-      read_ldf(nbrcnt_r_file, c++, sr_na);
-      for(i=0; i<nbrcnt_info.n_alpha; i++)
-         compute_perc_interval(s, sr_na,
-                              nbrcnt_info.alpha[i],
-                              nbrcnt_info.o_rate.v_bcl[i],
-                              nbrcnt_info.o_rate.v_bcu[i]);
+   //
+   // Initialize column counter
+   //
+   c = 0;
 
-   } // end try block
+   //
+   // Compute bootstrap interval for FBS
+   //
+   s = nbrcnt_info.fbs.v;
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.fbs.v_bcl[i],
+                           nbrcnt_info.fbs.v_bcu[i]);
 
    //
-   // Catch any thrown errors
+   // Compute bootstrap interval for FSS
    //
-   catch(int i_err) {
+   s = nbrcnt_info.fss.v;
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.fss.v_bcl[i],
+                           nbrcnt_info.fss.v_bcu[i]);
 
-      mlog << Error << "\ncompute_nbrcnt_stats_ci_perc() -> "
-           << "encountered an error value of " << i_err
-           << ".  Deleting temp files before exiting.\n\n";
+   //
+   // Compute bootstrap interval for AFSS
+   //
+   s = nbrcnt_info.afss.v;
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.afss.v_bcl[i],
+                           nbrcnt_info.afss.v_bcu[i]);
 
-      //
-      // Attempt to delete temp files
-      //
-      remove_temp_file(nbrcnt_r_file);
+   //
+   // Compute bootstrap interval for UFSS
+   //
+   s = nbrcnt_info.ufss.v;
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.ufss.v_bcl[i],
+                           nbrcnt_info.ufss.v_bcu[i]);
 
-      exit(i_err);
-   } // end catch block
+   //
+   // Compute bootstrap interval for F_RATE
+   //
+   s = nbrcnt_info.f_rate.v;
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.f_rate.v_bcl[i],
+                           nbrcnt_info.f_rate.v_bcu[i]);
 
    //
-   // Delete temp files
+   // Compute bootstrap interval for O_RATE
    //
-   remove_temp_file(nbrcnt_r_file);
+   s = nbrcnt_info.o_rate.v;
+   nbrcnt_r_tab.get_col(c++, sr_na);
+   for(i=0; i<nbrcnt_info.n_alpha; i++)
+      compute_perc_interval(s, sr_na,
+                           nbrcnt_info.alpha[i],
+                           nbrcnt_info.o_rate.v_bcl[i],
+                           nbrcnt_info.o_rate.v_bcu[i]);
 
    return;
 }
@@ -3923,106 +3717,177 @@ void compute_perc_interval(double s, NumArray &sr_na,
 
 ////////////////////////////////////////////////////////////////////////
 
-void write_cntinfo(ofstream &tmp_out, const CNTInfo &c) {
-   char line[max_line_len];
+void write_cntinfo(BootStatTable &t, int row, const CNTInfo &c) {
+   int i = 0;
+
+   t.set(row, i++, c.fbar.v);
+   t.set(row, i++, c.fstdev.v);
+   t.set(row, i++, c.obar.v);
+   t.set(row, i++, c.ostdev.v);
+   t.set(row, i++, c.pr_corr.v);
+   t.set(row, i++, c.anom_corr.v);
+   t.set(row, i++, c.rmsfa.v);
+   t.set(row, i++, c.rmsoa.v);
+   t.set(row, i++, c.anom_corr_uncntr.v);
+   t.set(row, i++, c.me.v);
+   t.set(row, i++, c.me2.v);
+   t.set(row, i++, c.estdev.v);
+   t.set(row, i++, c.mbias.v);
+   t.set(row, i++, c.mae.v);
+   t.set(row, i++, c.mse.v);
+   t.set(row, i++, c.msess.v);
+   t.set(row, i++, c.bcmse.v);
+   t.set(row, i++, c.rmse.v);
+   t.set(row, i++, c.si.v);
+   t.set(row, i++, c.e10.v);
+   t.set(row, i++, c.e25.v);
+   t.set(row, i++, c.e50.v);
+   t.set(row, i++, c.e75.v);
+   t.set(row, i++, c.e90.v);
+   t.set(row, i++, c.eiqr.v);
+   t.set(row, i++, c.mad.v);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void write_ctsinfo(BootStatTable &t, int row, const CTSInfo &c) {
+   int i = 0;
+
+   t.set(row, i++, c.baser.v);
+   t.set(row, i++, c.fmean.v);
+   t.set(row, i++, c.acc.v);
+   t.set(row, i++, c.fbias.v);
+   t.set(row, i++, c.pody.v);
+   t.set(row, i++, c.podn.v);
+   t.set(row, i++, c.pofd.v);
+   t.set(row, i++, c.far.v);
+   t.set(row, i++, c.csi.v);
+   t.set(row, i++, c.gss.v);
+   t.set(row, i++, c.hk.v);
+   t.set(row, i++, c.hss.v);
+   t.set(row, i++, c.hss_ec.v);
+   t.set(row, i++, c.odds.v);
+   t.set(row, i++, c.lodds.v);
+   t.set(row, i++, c.orss.v);
+   t.set(row, i++, c.eds.v);
+   t.set(row, i++, c.seds.v);
+   t.set(row, i++, c.edi.v);
+   t.set(row, i++, c.sedi.v);
+   t.set(row, i++, c.bagss.v);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void write_mctsinfo(BootStatTable &t, int row, const MCTSInfo &c) {
+   int i = 0;
+
+   t.set(row, i++, c.acc.v);
+   t.set(row, i++, c.hk.v);
+   t.set(row, i++, c.hss.v);
+   t.set(row, i++, c.hss_ec.v);
+   t.set(row, i++, c.ger.v);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
 
-   snprintf(line, max_line_len,
-           "%f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f",
-           c.fbar.v,    c.fstdev.v,    c.obar.v,          c.ostdev.v,
-           c.pr_corr.v, c.anom_corr.v,
-           c.rmsfa.v,   c.rmsoa.v,     c.anom_corr_uncntr.v,
-           c.me.v,      c.me2.v,       c.estdev.v,        c.mbias.v,
-           c.mae.v,     c.mse.v,       c.msess.v,         c.bcmse.v,
-           c.rmse.v,    c.si.v,        c.e10.v,           c.e25.v,
-           c.e50.v,     c.e75.v,       c.e90.v,           c.eiqr.v,
-           c.mad.v);
+void write_nbrcntinfo(BootStatTable &t, int row, const NBRCNTInfo &c) {
+   int i = 0;
 
-   tmp_out << line << "\n";
+   t.set(row, i++, c.fbs.v);
+   t.set(row, i++, c.fss.v);
+   t.set(row, i++, c.afss.v);
+   t.set(row, i++, c.ufss.v);
+   t.set(row, i++, c.f_rate.v);
+   t.set(row, i++, c.o_rate.v);
 
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Draw one seed per bootstrap replicate from the input random number
+// generator.  Each replicate reseeds its own generator so that the
+// results do not depend on the number of OpenMP threads.
+//
 ////////////////////////////////////////////////////////////////////////
 
-void write_ctsinfo(ofstream &tmp_out, const CTSInfo &c) {
-   char line[max_line_len];
+void draw_rep_seeds(const gsl_rng *rng_ptr, int b,
+                    vector<unsigned long> &seeds) {
 
-   snprintf(line, max_line_len,
-           "%f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f %f",
-           c.baser.v,   c.fmean.v,   c.acc.v,     c.fbias.v,
-           c.pody.v,    c.podn.v,    c.pofd.v,    c.far.v,
-           c.csi.v,     c.gss.v,     c.hk.v,      c.hss.v,
-           c.hss_ec.v,  c.odds.v,    c.lodds.v,   c.orss.v,
-           c.eds.v,     c.seds.v,    c.edi.v,     c.sedi.v,
-           c.bagss.v
-          );
+   seeds.resize(b);
 
-   tmp_out << line << "\n";
+   for(int i=0; i<b; i++) seeds[i] = gsl_rng_get(rng_ptr);
 
    return;
 }
 
 ////////////////////////////////////////////////////////////////////////
 
-void write_mctsinfo(ofstream &tmp_out, const MCTSInfo &c) {
-   char line[max_line_len];
+void ran_sample_rep(gsl_rng *rep_rng, unsigned long seed,
+                    NumArray &i_na, NumArray &ir_na, int m) {
 
-   snprintf(line, max_line_len, "%f %f %f %f %f",
-           c.acc.v, c.hk.v, c.hss.v, c.hss_ec.v, c.ger.v);
+   gsl_rng_set(rep_rng, seed);
 
-   tmp_out << line << "\n";
+   ran_sample(rep_rng, i_na, ir_na, m);
 
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Code for class BootStatTable
+//
+////////////////////////////////////////////////////////////////////////
+
+BootStatTable::BootStatTable() {
+
+   Nrows = Ncols = 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+BootStatTable::~BootStatTable() { }
+
 ////////////////////////////////////////////////////////////////////////
 
-void write_nbrcntinfo(ofstream &tmp_out, const NBRCNTInfo &c) {
-   char line[max_line_len];
+void BootStatTable::set_size(int n_rows, int n_cols) {
 
-   snprintf(line, max_line_len,
-           "%f %f %f %f %f %f",
-           c.fbs.v, c.fss.v, c.afss.v, c.ufss.v, c.f_rate.v, c.o_rate.v);
+   Nrows = n_rows;
+   Ncols = n_cols;
 
-   tmp_out << line << "\n";
+   Data.assign((size_t) Nrows*Ncols, bad_data_double);
 
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Copy the valid values from the requested column.
+//
 ////////////////////////////////////////////////////////////////////////
 
-void read_ldf(const ConcatString file_name, int col, NumArray &na) {
-   LineDataFile ldf_in;
-   DataLine line;
-   double v;
+void BootStatTable::get_col(int col, NumArray &na) const {
 
-   //
-   // Open up the input file for reading
-   //
-   if(!ldf_in.open(file_name.c_str())) {
-      mlog << Error << "\nread_ldf() -> "
-           << "can't open file: " << file_name << "\n\n"
-          ;
-      throw(1);
+   if(col < 0 || col >= Ncols) {
+      mlog << Error << "\nBootStatTable::get_col() -> "
+           << "range check error for column " << col << "!\n\n";
+      exit(1);
    }
 
-   //
-   // Clear out the NumArray
-   //
-   na.clear();
+   na.erase();
+   na.extend(Nrows);
 
-   //
-   // Read the data in the column specified
-   //
-   while(ldf_in >> line) {
-      v = atof(line.get_item(col-1));
-      if(!is_bad_data(v)) na.add(v);
-   }
+   const double *d = Data.data() + (size_t) col*Nrows;
 
-   //
-   // Close the input file
-   //
-   ldf_in.close();
+   for(int i=0; i<Nrows; i++) {
+      if(!is_bad_data(d[i])) na.add(d[i]);
+   }
 
    return;
 }
@@ -46,44 +46,36 @@ extern void compute_hk_ci(double hk, double alpha, double vif,
    double &hk_cl, double &hk_cu);
 
 extern void compute_cts_stats_ci_bca(const gsl_rng *,
-   const PairDataPoint &, int, CTSInfo *&, int, bool, bool,
-   const char *);
+   const PairDataPoint &, int, CTSInfo *&, int, bool, bool);
 
 extern void compute_mcts_stats_ci_bca(const gsl_rng *,
-   const PairDataPoint &, int, MCTSInfo &, bool, bool,
-   const char *);
+   const PairDataPoint &, int, MCTSInfo &, bool, bool);
 
 extern void compute_cnt_stats_ci_bca(const gsl_rng *,
-   const PairDataPoint &, bool, bool, int, CNTInfo &,
-   const char *);
+   const PairDataPoint &, bool, bool, int, CNTInfo &);
 
 extern void compute_cts_stats_ci_perc(const gsl_rng *,
-   const PairDataPoint &, int, double, CTSInfo *&, int, bool, bool,
-   const char *);
+   const PairDataPoint &, int, double, CTSInfo *&, int, bool, bool);
 
 extern void compute_mcts_stats_ci_perc(const gsl_rng *,
-   const PairDataPoint &, int, double, MCTSInfo &, bool, bool,
-   const char *);
+   const PairDataPoint &, int, double, MCTSInfo &, bool, bool);
 
 extern void compute_cnt_stats_ci_perc(const gsl_rng *,
-   const PairDataPoint &, bool, bool, int, double, CNTInfo &,
-   const char *);
+   const PairDataPoint &, bool, bool, int, double, CNTInfo &);
 
 extern void compute_nbrcts_stats_ci_bca(const gsl_rng *,
-   const PairDataPoint &, int, NBRCTSInfo *&, int, bool,
-   const char *);
+   const PairDataPoint &, int, NBRCTSInfo *&, int, bool);
 
 extern void compute_nbrcnt_stats_ci_bca(const gsl_rng *,
    const PairDataPoint &,  const PairDataPoint &,
-   int, NBRCNTInfo &, bool, const char *);
+   int, NBRCNTInfo &, bool);
 
 extern void compute_nbrcts_stats_ci_perc(const gsl_rng *,
-   const PairDataPoint &, int, double, NBRCTSInfo *&, int, bool,
-   const char *);
+   const PairDataPoint &, int, double, NBRCTSInfo *&, int, bool);
 
 extern void compute_nbrcnt_stats_ci_perc(const gsl_rng *,
    const PairDataPoint &,  const PairDataPoint &,
-   int, double, NBRCNTInfo &, bool, const char *);
+   int, double, NBRCNTInfo &, bool);
 
 extern void compute_mean_stdev_ci_bca(const gsl_rng *, const NumArray &,
    int, double, CIInfo &, CIInfo &);
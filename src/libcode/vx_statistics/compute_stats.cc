@@ -16,6 +16,7 @@ using namespace std;
 #include <stdlib.h>
 #include <string.h>
 #include <cmath>
+#include <algorithm>
 
 #include "pair_data_point.h"
 #include "compute_stats.h"
@@ -27,6 +28,120 @@ using namespace std;
 
 const int detailed_debug_level = 5;
 
+////////////////////////////////////////////////////////////////////////
+
+static void compute_kendall_counts(const NumArray &f_rank,
+                                   const NumArray &o_rank, int n,
+                                   const vector<int> &f_order,
+                                   long long &concordant,
+                                   long long &discordant,
+                                   long long &extra_f,
+                                   long long &extra_o);
+
+
+////////////////////////////////////////////////////////////////////////
+//
+// Count the concordant, discordant, and tied pairs of ranks in
+// O(n log n) using Knight's algorithm.  The pairs are sorted by
+// forecast rank, then by observation rank within forecast ties, and a
+// merge sort by observation rank counts the discordant pairs as the
+// number of swaps.  The f_order array contains the indices of the
+// forecast ranks in increasing order, if available.
+//
+////////////////////////////////////////////////////////////////////////
+
+static void compute_kendall_counts(const NumArray &f_rank,
+                                   const NumArray &o_rank, int n,
+                                   const vector<int> &f_order,
+                                   long long &concordant,
+                                   long long &discordant,
+                                   long long &extra_f,
+                                   long long &extra_o) {
+   vector<double> o_val(n), o_tmp(n);
+   vector<int> idx(n);
+   long long n_pair, f_ties, o_ties, fo_ties, swaps;
+   int i, j, k, width, lo, mid, hi;
+
+   concordant = discordant = extra_f = extra_o = 0;
+
+   if(n <= 1) return;
+
+   //
+   // Sort the pairs by forecast rank, reusing the order from ranking
+   //
+   if((int) f_order.size() == n) {
+      idx = f_order;
+   }
+   else {
+      for(i=0; i<n; i++) idx[i] = i;
+      sort(idx.begin(), idx.end(),
+           [&f_rank](int a, int b) { return(f_rank[a] < f_rank[b]); });
+   }
+
+   //
+   // Sort by observation rank within the forecast ties and count the
+   // pairs tied in the forecast and tied in both
+   //
+   f_ties = fo_ties = 0;
+   for(i=0; i<n; i=j) {
+      for(j=i+1; j<n && f_rank[idx[j]] == f_rank[idx[i]]; j++);
+
+      if(j - i == 1) continue;
+
+      f_ties += (long long) (j - i) * (j - i - 1) / 2;
+
+      sort(idx.begin() + i, idx.begin() + j,
+           [&o_rank](int a, int b) { return(o_rank[a] < o_rank[b]); });
+
+      for(k=i; k<j; ) {
+         int l;
+         for(l=k+1; l<j && o_rank[idx[l]] == o_rank[idx[k]]; l++);
+         fo_ties += (long long) (l - k) * (l - k - 1) / 2;
+         k = l;
+      }
+   }
+
+   for(i=0; i<n; i++) o_val[i] = o_rank[idx[i]];
+
+   //
+   // Bottom-up merge sort of the observation ranks, counting the number
+   // of swaps needed
+   //
+   swaps = 0;
+   for(width=1; width<n; width*=2) {
+      for(lo=0; lo<n; lo+=2*width) {
+         mid = min(lo + width, n);
+         hi  = min(lo + 2*width, n);
+         for(i=lo, j=mid, k=lo; k<hi; k++) {
+            if(j >= hi || (i < mid && o_val[i] <= o_val[j])) {
+               o_tmp[k] = o_val[i++];
+            }
+            else {
+               o_tmp[k] = o_val[j++];
+               swaps += mid - i;
+            }
+         }
+      }
+      o_val.swap(o_tmp);
+   }
+
+   //
+   // Count the pairs tied in the observation
+   //
+   o_ties = 0;
+   for(i=0; i<n; i=j) {
+      for(j=i+1; j<n && o_val[j] == o_val[i]; j++);
+      o_ties += (long long) (j - i) * (j - i - 1) / 2;
+   }
+
+   n_pair     = (long long) n * (n - 1) / 2;
+   discordant = swaps;
+   concordant = n_pair - f_ties - o_ties + fo_ties - swaps;
+   extra_o    = f_ties - fo_ties;
+   extra_f    = o_ties - fo_ties;
+
+   return;
+}
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -371,9 +486,10 @@ void compute_cntinfo(const PairDataPoint &pd, const NumArray &i_na,
    // coefficients if the rank_flag is set.
    //
    if(rank_flag) {
-      int concordant, discordant, extra_f, extra_o;
+      long long concordant, discordant, extra_f, extra_o;
       int n_f_rank, n_o_rank, n_f_rank_ties, n_o_rank_ties;
       NumArray f_na2, o_na2, f_na_rank, o_na_rank, wgt_na2;
+      vector<int> f_order;
 
       //
       // Allocate memory
@@ -407,7 +523,7 @@ void compute_cntinfo(const PairDataPoint &pd, const NumArray &i_na,
       //
       f_na_rank = f_na2;
       o_na_rank = o_na2;
-      n_f_rank  = f_na_rank.rank_array(n_f_rank_ties);
+      n_f_rank  = f_na_rank.rank_array(n_f_rank_ties, &f_order);
       n_o_rank  = o_na_rank.rank_array(n_o_rank_ties);
 
       if(n_f_rank != n_o_rank) {
@@ -466,34 +582,14 @@ void compute_cntinfo(const PairDataPoint &pd, const NumArray &i_na,
       // comparison as extra_f.  A tie between the f's counts as an extra_o.  If there
       // is a tie in both the f's and o's, don't count the comparison as anything.
       //
-      concordant = discordant = extra_f = extra_o = 0;
-      for(i=0; i<n; i++) {
-         for(j=i+1; j<n; j++) {
-
-            //
-            // Check for agreement in the relative ordering of ranks
-            //
-            if(      (f_na_rank[i] > f_na_rank[j] && o_na_rank[i] > o_na_rank[j]) ||
-                     (f_na_rank[i] < f_na_rank[j] && o_na_rank[i] < o_na_rank[j]) ) concordant++;
-            //
-            // Check for disagreement in the relative ordering of ranks
-            //
-            else if( (f_na_rank[i] > f_na_rank[j] && o_na_rank[i] < o_na_rank[j]) ||
-                     (f_na_rank[i] < f_na_rank[j] && o_na_rank[i] > o_na_rank[j]) ) discordant++;
-            //
-            // Check for ties in the forecast rank
-            //
-            else if(is_eq(f_na_rank[i], f_na_rank[j]) && !is_eq(o_na_rank[i], o_na_rank[j])) extra_o++;
-            //
-            // Check for ties in the observation rank
-            //
-            else if(!is_eq(f_na_rank[i], f_na_rank[j]) && is_eq(o_na_rank[i], o_na_rank[j])) extra_f++;
-         }
-      }
+      if(f_na_rank.n() != n) f_order.clear();
+      compute_kendall_counts(f_na_rank, o_na_rank, n, f_order,
+                             concordant, discordant, extra_f, extra_o);
+
       den = sqrt((double) concordant+discordant+extra_f)*
             sqrt((double) concordant+discordant+extra_o);
       if(is_eq(den, 0.0)) cnt_info.kt_corr.v = bad_data_double;
-      else                cnt_info.kt_corr.v = (concordant - discordant)/den;
+      else                cnt_info.kt_corr.v = (double) (concordant - discordant)/den;
    } // end if rank_flag
 
    //
@@ -575,22 +671,22 @@ void compute_ctsinfo(const PairDataPoint &pd, const NumArray &i_na,
    cts_info.cts.zero_out();
 
    //
-   // Loop through the pair data and fill in the contingency table
+   // Gather the pairs selected by the index num array
    //
+   vector<double> f(n), o(n), cmn(n), csd(n);
    for(i=0; i<n; i++) {
-
-      //
-      // Get the index to be used from the index num array
-      //
       j = nint(i_na[i]);
-
-      //
-      // Add this pair to the contingency table
-      //
-      cts_info.add(pd.f_na[j], pd.o_na[j], pd.cmn_na[j], pd.csd_na[j]);
-
+      f[i]   = pd.f_na[j];
+      o[i]   = pd.o_na[j];
+      cmn[i] = pd.cmn_na[j];
+      csd[i] = pd.csd_na[j];
    } // end for i
 
+   //
+   // Fill in the contingency table
+   //
+   cts_info.add(f.data(), o.data(), cmn.data(), csd.data(), n);
+
    //
    // Only compute the categorical stats if reqeusted
    //
@@ -792,15 +888,22 @@ void compute_pctinfo(const PairDataPoint &pd, bool pstd_flag,
    pct_info.climo_pct.set_size(n_thresh-1);
    pct_info.climo_pct.set_thresholds(p_thresh.vals());
 
+   //
+   // Check the observation thresholds for all pairs at once
+   //
+   bool *o_tf = new bool [n_pair];
+   pct_info.othresh.check(pd.o_na.vals(), pd.cmn_na.vals(),
+                          pd.csd_na.vals(), n_pair, o_tf);
+
    //
    // Loop through the pair data and fill in the contingency table
    //
    for(i=0; i<n_pair; i++) {
 
       //
-      // Check the observation thresholds and increment accordingly
+      // Increment according to the observation thresholds
       //
-      if(pct_info.othresh.check(pd.o_na[i], pd.cmn_na[i], pd.csd_na[i])) {
+      if(o_tf[i]) {
          pct_info.pct.inc_event(pd.f_na[i]);
          if(cmn_flag) pct_info.climo_pct.inc_event(climo_prob[i]);
       }
@@ -810,6 +913,8 @@ void compute_pctinfo(const PairDataPoint &pd, bool pstd_flag,
       }
    } // end for i
 
+   if(o_tf) { delete [] o_tf; o_tf = (bool *) 0; }
+
    //
    // Only compute the probabilistic stats if reqeusted
    //
@@ -167,8 +167,6 @@ class Nx2ContingencyTable : public ContingencyTable {
 
       double * Thresholds;   //  N + 1 count, increasing
 
-      int value_to_row(double) const;
-
       void init_from_scratch();
 
       void assign(const Nx2ContingencyTable &);
@@ -193,6 +191,8 @@ class Nx2ContingencyTable : public ContingencyTable {
 
       double threshold(int index) const;   //  0 <= index <= Nrows
 
+      int value_to_row(double) const;      //  -1 if out of range
+
          //
          //  increment counts
          //
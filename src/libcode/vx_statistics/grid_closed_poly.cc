@@ -148,6 +148,44 @@ int GridClosedPoly::is_inside(double u_test, double v_test) const {
    return(status);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+
+void GridClosedPoly::set_mask_inside(MaskPlane &mask) const {
+   int x, y, x_beg, x_end, y_beg, y_end;
+
+   if(n_points == 0) return;
+
+   //
+   //  limit the search to grid points inside the bounding box
+   //
+
+   x_beg = 0;
+   x_end = mask.nx() - 1;
+   y_beg = 0;
+   y_end = mask.ny() - 1;
+
+   if(u_min > x_end || u_max < x_beg ||
+      v_min > y_end || v_max < y_beg) return;
+
+   if(u_min > x_beg) x_beg = nint(ceil(u_min));
+   if(u_max < x_end) x_end = nint(floor(u_max));
+   if(v_min > y_beg) y_beg = nint(ceil(v_min));
+   if(v_max < y_end) y_end = nint(floor(v_max));
+
+   for(x=x_beg; x<=x_end; x++) {
+      for(y=y_beg; y<=y_end; y++) {
+
+         if(mask(x, y)) continue;
+
+         if(Polyline::is_inside((double) x, (double) y) != 0) {
+            mask.put(true, x, y);
+         }
+      }
+   }
+
+   return;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 //
 // Code for class GridClosedPolyArray
@@ -176,6 +214,15 @@ bool GridClosedPolyArray::is_inside(double u_test, double v_test) const {
 
 ///////////////////////////////////////////////////////////////////////////////
 
+void GridClosedPolyArray::set_mask_inside(MaskPlane &mask) const {
+
+   for(int j=0; j<Nelements; j++) e[j]->set_mask_inside(mask);
+
+   return;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
 void GridClosedPolyArray::set(const ShpPolyRecord &r, const Grid &grid) {
 
    clear();
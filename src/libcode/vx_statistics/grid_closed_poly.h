@@ -31,6 +31,7 @@
 #include "shp_file.h"
 #include "shp_poly_record.h"
 #include "vx_grid.h"
+#include "data_plane.h"
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -61,6 +62,10 @@ class GridClosedPoly : public Polyline {
       // updates bounding box for each new point
       void add_point(double, double);
 
+      // turns on the grid points of the mask that are inside,
+      // only testing the points within the bounding box
+      void set_mask_inside(MaskPlane &) const;
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -73,6 +78,8 @@ class GridClosedPolyArray : public NCRR_Array<GridClosedPoly> {
 
       void set(const ShpPolyRecord &, const Grid &);
 
+      void set_mask_inside(MaskPlane &) const;
+
 };
 
 ///////////////////////////////////////////////////////////////////////////////
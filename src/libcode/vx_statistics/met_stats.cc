@@ -344,6 +344,36 @@ void CTSInfo::add(double f, double o, double cmn, double csd) {
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Add n pairs, applying each threshold to all of them at once
+//
+////////////////////////////////////////////////////////////////////////
+
+void CTSInfo::add(const double *f, const double *o,
+                  const double *cmn, const double *csd, int n) {
+
+   if(n <= 0) return;
+
+   bool *f_tf = new bool [n];
+   bool *o_tf = new bool [n];
+
+   fthresh.check(f, cmn, csd, n, f_tf);
+   othresh.check(o, cmn, csd, n, o_tf);
+
+   for(int i=0; i<n; i++) {
+      if     ( f_tf[i] &&  o_tf[i]) cts.inc_fy_oy();
+      else if( f_tf[i] && !o_tf[i]) cts.inc_fy_on();
+      else if(!f_tf[i] &&  o_tf[i]) cts.inc_fn_oy();
+      else                          cts.inc_fn_on();
+   }
+
+   if(f_tf) { delete [] f_tf; f_tf = (bool *) 0; }
+   if(o_tf) { delete [] o_tf; o_tf = (bool *) 0; }
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 void CTSInfo::compute_stats() {
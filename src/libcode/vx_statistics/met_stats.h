@@ -95,6 +95,8 @@ class CTSInfo {
       void allocate_n_alpha(int);
       void add(double, double);
       void add(double, double, double, double);
+      void add(const double *, const double *,
+               const double *, const double *, int);
       void compute_stats();
       void compute_ci();
 
@@ -0,0 +1,161 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+#include <cstdio>
+#include <iostream>
+#include <string.h>
+
+#include "obs_router.h"
+
+#include "vx_log.h"
+
+////////////////////////////////////////////////////////////////////////
+//
+// Code for class PointObsRouter
+//
+////////////////////////////////////////////////////////////////////////
+
+PointObsRouter::PointObsRouter() {
+
+   init_from_scratch();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+PointObsRouter::~PointObsRouter() {
+
+   clear();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsRouter::init_from_scratch() {
+
+   clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsRouter::clear() {
+
+   NVx = 0;
+
+   NameMap.clear();
+   CodeMap.clear();
+   AllVx.clear();
+
+   NameRoute.clear();
+   CodeRoute.clear();
+
+   NObs = 0;
+   NRouted.clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void PointObsRouter::add(int i_vx, const VarInfoGrib *obs_info,
+                         bool route_obs) {
+
+   if(route_obs) {
+      NameMap[obs_info->name().string()].add(i_vx);
+      CodeMap[obs_info->code()].add(i_vx);
+   }
+   else {
+      AllVx.add(i_vx);
+   }
+
+   // Reset the merged lists
+   NameRoute.clear();
+   CodeRoute.clear();
+
+   if(i_vx >= NVx) NVx = i_vx + 1;
+
+   NRouted.resize(NVx, 0);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+IntArray PointObsRouter::merge_route(const IntArray *ia) const {
+   IntArray route;
+   int i = 0, j = 0;
+
+   // Merge the sorted lists of task indices
+   while((ia && i < ia->n()) || j < AllVx.n()) {
+      if(j >= AllVx.n() || (ia && i < ia->n() && (*ia)[i] < AllVx[j])) {
+         route.add((*ia)[i++]);
+      }
+      else {
+         route.add(AllVx[j++]);
+      }
+   }
+
+   return(route);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Return the tasks which could accept an observation of this variable.
+// As in add_point_obs(), observations are matched by variable name if
+// one is provided and otherwise by GRIB code.
+//
+////////////////////////////////////////////////////////////////////////
+
+const IntArray & PointObsRouter::lookup(const char *var_name, float grib_code) {
+   const IntArray *route = (const IntArray *) 0;
+
+   if(var_name != 0 && strlen(var_name) > 0) {
+      map<string,IntArray>::iterator it = NameRoute.find(var_name);
+      if(it == NameRoute.end()) {
+         map<string,IntArray>::const_iterator m_it = NameMap.find(var_name);
+         it = NameRoute.insert(pair<string,IntArray>(var_name,
+                 merge_route(m_it == NameMap.end() ? 0 : &(m_it->second)))).first;
+      }
+      route = &(it->second);
+   }
+   else {
+      int code = nint(grib_code);
+      map<int,IntArray>::iterator it = CodeRoute.find(code);
+      if(it == CodeRoute.end()) {
+         map<int,IntArray>::const_iterator m_it = CodeMap.find(code);
+         it = CodeRoute.insert(pair<int,IntArray>(code,
+                 merge_route(m_it == CodeMap.end() ? 0 : &(m_it->second)))).first;
+      }
+      route = &(it->second);
+   }
+
+   // Update the counts
+   NObs++;
+   for(int i=0; i<route->n(); i++) NRouted[(*route)[i]]++;
+
+   return(*route);
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Number of observations looked up which were not routed to a task.
+//
+////////////////////////////////////////////////////////////////////////
+
+int PointObsRouter::n_skipped(int i_vx) const {
+
+   if(i_vx < 0 || i_vx >= (int) NRouted.size()) return(NObs);
+
+   return(NObs - NRouted[i_vx]);
+}
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,85 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+////////////////////////////////////////////////////////////////////////
+
+#ifndef  __OBS_ROUTER_H__
+#define  __OBS_ROUTER_H__
+
+////////////////////////////////////////////////////////////////////////
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "vx_util.h"
+#include "var_info_grib.h"
+
+////////////////////////////////////////////////////////////////////////
+//
+// Index of the verification tasks by observation variable, so that
+// each point observation is only offered to the tasks which could
+// accept it.  Observations are routed by variable name, when the
+// point observation file defines them, or by GRIB code, using the
+// same logic as the add_point_obs() functions.
+//
+// Tasks added with route_obs set to false are offered every
+// observation.
+//
+////////////////////////////////////////////////////////////////////////
+
+class PointObsRouter {
+
+   private:
+
+      void init_from_scratch();
+
+      PointObsRouter(const PointObsRouter &);
+      PointObsRouter & operator=(const PointObsRouter &);
+
+      int NVx;
+
+      std::map<std::string,IntArray> NameMap;
+      std::map<int,IntArray>         CodeMap;
+      IntArray                       AllVx;
+
+         //
+         // Merged lists of tasks for each lookup key
+         //
+
+      std::map<std::string,IntArray> NameRoute;
+      std::map<int,IntArray>         CodeRoute;
+
+         //
+         // Number of observations looked up and routed to each task
+         //
+
+      int              NObs;
+      std::vector<int> NRouted;
+
+      IntArray merge_route(const IntArray *) const;
+
+   public:
+
+      PointObsRouter();
+     ~PointObsRouter();
+
+      void clear();
+
+      void add(int i_vx, const VarInfoGrib *, bool route_obs = true);
+
+      const IntArray & lookup(const char *var_name, float grib_code);
+
+      int n_skipped(int i_vx) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////
+
+#endif   /*  __OBS_ROUTER_H__  */
+
+////////////////////////////////////////////////////////////////////////
@@ -364,7 +364,7 @@ void PairDataEnsemble::add_obs_error_entry(ObsErrorEntry *e) {
 void PairDataEnsemble::compute_pair_vals(const gsl_rng *rng_ptr) {
    int i, j, k, n_vld, n_bel, n_tie;
    int n_skip_const, n_skip_vld;
-   NumArray src_na, dest_na, cur_ens, cur_clm;
+   NumArray src_na, dest_na, cur_ens, cur_srt, cur_clm;
    double mean, stdev, var_unperturbed, var_perturbed;
 
    // Check if the ranks have already been computed
@@ -505,13 +505,18 @@ void PairDataEnsemble::compute_pair_vals(const gsl_rng *rng_ptr) {
          // Derive ensemble from climo mean and standard deviation
          derive_climo_vals(cdf_info_ptr, cmn_na[i], csd_na[i], cur_clm);
 
+         // Sort the ensemble once for the empirical CRPS and
+         // mean absolute difference
+         cur_srt = cur_ens;
+         cur_srt.sort_array();
+
          // Store empirical CRPS stats
          //
          // For crps_emp use temporary, local variable so we can use it for the crps_emp_fair calculation
-         double crps_emp = compute_crps_emp(o_na[i], cur_ens);
+         double crps_emp = compute_crps_emp(o_na[i], cur_srt);
          crps_emp_na.add(crps_emp);
-         crps_emp_fair_na.add(crps_emp - cur_ens.wmean_abs_diff());
-         spread_md_na.add(cur_ens.mean_abs_diff());
+         crps_emp_fair_na.add(crps_emp - cur_srt.wmean_abs_diff());
+         spread_md_na.add(cur_srt.mean_abs_diff());
          crpscl_emp_na.add(compute_crps_emp(o_na[i], cur_clm));
 
          // Ensemble mean and standard deviation
@@ -1967,7 +1972,7 @@ double compute_crps_emp(double obs, const NumArray &ens_na) {
    for(i=0; i<ens_na.n(); i++) {
       if(!is_bad_data(ens_na[i])) evals.add(ens_na[i]);
    }
-   evals.sort_array();
+   if(!ens_na.is_sorted()) evals.sort_array();
 
    // Check for bad or no data
    if(is_bad_data(obs) || evals.n() == 0) return(bad_data_double);
@@ -1211,6 +1211,12 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
    bool has_seeps = false;
    SeepsScore *seeps = 0;
 
+   // Interpolated values for each interpolation method
+   vector<bool>   interp_done(n_interp, false);
+   vector<double> fcst_na(n_interp, bad_data_double);
+   vector<double> cmn_na (n_interp, bad_data_double);
+   vector<double> csd_na (n_interp, bad_data_double);
+
    // Check the message types
    for(i=0; i<n_msg_typ; i++) {
 
@@ -1255,19 +1261,22 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
          // Compute the interpolated values
          for(k=0; k<n_interp; k++) {
 
-            // Compute the interpolated forecast value using the
-            // observation pressure level or height
-            to_lvl = (fcst_info->level().type() == LevelType_Pres ?
-                      obs_lvl : obs_hgt);
+            // Interpolate once for this observation and reuse the
+            // values for each message type and masking region
+            if(!interp_done[k]) {
+               compute_interp_values(k, obs_x, obs_y, obs_v, hdr_elv,
+                                     obs_lvl, obs_hgt, hdr_typ_str, gr,
+                                     spfh_flag,
+                                     f_lvl_blw, f_lvl_abv,
+                                     cmn_lvl_blw, cmn_lvl_abv,
+                                     csd_lvl_blw, csd_lvl_abv,
+                                     fcst_na[k], cmn_na[k], csd_na[k]);
+               interp_done[k] = true;
+            }
 
-            // Compute the interpolated climatology mean
-            cmn_v = compute_interp(climo_mn_dpa, obs_x, obs_y, obs_v,
-                       bad_data_double, bad_data_double,
-                       pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
-                       pd[0][0][k].interp_shape, gr.wrap_lon(),
-                       interp_thresh, spfh_flag,
-                       fcst_info->level().type(),
-                       to_lvl, cmn_lvl_blw, cmn_lvl_abv);
+            fcst_v = fcst_na[k];
+            cmn_v  = cmn_na[k];
+            csd_v  = csd_na[k];
 
             // Check for bad data
             if(climo_mn_dpa.n_planes() > 0 && is_bad_data(cmn_v)) {
@@ -1275,65 +1284,12 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
                continue;
             }
 
-            // Check for valid interpolation options
-            if(climo_sd_dpa.n_planes() > 0 &&
-               (pd[0][0][k].interp_mthd == InterpMthd_Min    ||
-                pd[0][0][k].interp_mthd == InterpMthd_Max    ||
-                pd[0][0][k].interp_mthd == InterpMthd_Median ||
-                pd[0][0][k].interp_mthd == InterpMthd_Best)) {
-               mlog << Warning << "\nVxPairDataPoint::add_point_obs() -> "
-                    << "applying the "
-                    << interpmthd_to_string(pd[0][0][k].interp_mthd)
-                    << " interpolation method to climatological spread "
-                    << "may cause unexpected results.\n\n";
-            }
-
-            // Compute the interpolated climatology standard deviation
-            csd_v = compute_interp(climo_sd_dpa, obs_x, obs_y, obs_v,
-                       bad_data_double, bad_data_double,
-                       pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
-                       pd[0][0][k].interp_shape, gr.wrap_lon(),
-                       interp_thresh, spfh_flag,
-                       fcst_info->level().type(),
-                       to_lvl, csd_lvl_blw, csd_lvl_abv);
-
             // Check for bad data
             if(climo_sd_dpa.n_planes() > 0 && is_bad_data(csd_v)) {
                inc_count(rej_csd, i, j, k);
                continue;
             }
 
-            // For surface verification, apply land/sea and topo masks
-            if((sfc_info.land_ptr || sfc_info.topo_ptr) &&
-               (msg_typ_sfc.reg_exp_match(hdr_typ_str))) {
-
-               bool is_land = msg_typ_lnd.has(hdr_typ_str);
-
-               // Check for a single forecast DataPlane
-               if(fcst_dpa.n_planes() != 1) {
-                  mlog << Error << "\nVxPairDataPoint::add_point_obs() -> "
-                       << "unexpected number of forecast levels ("
-                       << fcst_dpa.n_planes()
-                       << ") for surface verification! Set \"land_mask.flag\" and "
-                       << "\"topo_mask.flag\" to false to disable this check.\n\n";
-                  exit(1);
-               }
-
-               fcst_v = compute_sfc_interp(fcst_dpa[0], obs_x, obs_y, hdr_elv, obs_v,
-                           pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
-                           pd[0][0][k].interp_shape, gr.wrap_lon(),
-                           interp_thresh, sfc_info, is_land);
-            }
-            // Otherwise, compute interpolated value
-            else {
-               fcst_v = compute_interp(fcst_dpa, obs_x, obs_y, obs_v, cmn_v, csd_v,
-                           pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
-                           pd[0][0][k].interp_shape, gr.wrap_lon(),
-                           interp_thresh, spfh_flag,
-                           fcst_info->level().type(),
-                           to_lvl, f_lvl_blw, f_lvl_abv);
-            }
-
             if(is_bad_data(fcst_v)) {
                mlog << Debug(4)
                     << "For " << fcst_info->magic_str() << " versus "
@@ -1396,6 +1352,103 @@ void VxPairDataPoint::add_point_obs(float *hdr_arr, const char *hdr_typ_str,
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Compute the interpolated climatology mean, climatology standard
+// deviation, and forecast values for the k-th interpolation method.
+// The later values are skipped once one of them is bad data.
+//
+////////////////////////////////////////////////////////////////////////
+
+void VxPairDataPoint::compute_interp_values(int k,
+                         double obs_x, double obs_y, double obs_v,
+                         double hdr_elv, double obs_lvl, double obs_hgt,
+                         const char *hdr_typ_str, const Grid &gr,
+                         bool spfh_flag,
+                         int f_lvl_blw, int f_lvl_abv,
+                         int cmn_lvl_blw, int cmn_lvl_abv,
+                         int csd_lvl_blw, int csd_lvl_abv,
+                         double &fcst_v, double &cmn_v, double &csd_v) {
+   double to_lvl;
+
+   fcst_v = cmn_v = csd_v = bad_data_double;
+
+   // Compute the interpolated forecast value using the
+   // observation pressure level or height
+   to_lvl = (fcst_info->level().type() == LevelType_Pres ?
+             obs_lvl : obs_hgt);
+
+   // Compute the interpolated climatology mean
+   cmn_v = compute_interp(climo_mn_dpa, obs_x, obs_y, obs_v,
+              bad_data_double, bad_data_double,
+              pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
+              pd[0][0][k].interp_shape, gr.wrap_lon(),
+              interp_thresh, spfh_flag,
+              fcst_info->level().type(),
+              to_lvl, cmn_lvl_blw, cmn_lvl_abv);
+
+   // Check for bad data
+   if(climo_mn_dpa.n_planes() > 0 && is_bad_data(cmn_v)) return;
+
+   // Check for valid interpolation options
+   if(climo_sd_dpa.n_planes() > 0 &&
+      (pd[0][0][k].interp_mthd == InterpMthd_Min    ||
+       pd[0][0][k].interp_mthd == InterpMthd_Max    ||
+       pd[0][0][k].interp_mthd == InterpMthd_Median ||
+       pd[0][0][k].interp_mthd == InterpMthd_Best)) {
+      mlog << Warning << "\nVxPairDataPoint::add_point_obs() -> "
+           << "applying the "
+           << interpmthd_to_string(pd[0][0][k].interp_mthd)
+           << " interpolation method to climatological spread "
+           << "may cause unexpected results.\n\n";
+   }
+
+   // Compute the interpolated climatology standard deviation
+   csd_v = compute_interp(climo_sd_dpa, obs_x, obs_y, obs_v,
+              bad_data_double, bad_data_double,
+              pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
+              pd[0][0][k].interp_shape, gr.wrap_lon(),
+              interp_thresh, spfh_flag,
+              fcst_info->level().type(),
+              to_lvl, csd_lvl_blw, csd_lvl_abv);
+
+   // Check for bad data
+   if(climo_sd_dpa.n_planes() > 0 && is_bad_data(csd_v)) return;
+
+   // For surface verification, apply land/sea and topo masks
+   if((sfc_info.land_ptr || sfc_info.topo_ptr) &&
+      (msg_typ_sfc.reg_exp_match(hdr_typ_str))) {
+
+      bool is_land = msg_typ_lnd.has(hdr_typ_str);
+
+      // Check for a single forecast DataPlane
+      if(fcst_dpa.n_planes() != 1) {
+         mlog << Error << "\nVxPairDataPoint::add_point_obs() -> "
+              << "unexpected number of forecast levels ("
+              << fcst_dpa.n_planes()
+              << ") for surface verification! Set \"land_mask.flag\" and "
+              << "\"topo_mask.flag\" to false to disable this check.\n\n";
+         exit(1);
+      }
+
+      fcst_v = compute_sfc_interp(fcst_dpa[0], obs_x, obs_y, hdr_elv, obs_v,
+                  pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
+                  pd[0][0][k].interp_shape, gr.wrap_lon(),
+                  interp_thresh, sfc_info, is_land);
+   }
+   // Otherwise, compute interpolated value
+   else {
+      fcst_v = compute_interp(fcst_dpa, obs_x, obs_y, obs_v, cmn_v, csd_v,
+                  pd[0][0][k].interp_mthd, pd[0][0][k].interp_wdth,
+                  pd[0][0][k].interp_shape, gr.wrap_lon(),
+                  interp_thresh, spfh_flag,
+                  fcst_info->level().type(),
+                  to_lvl, f_lvl_blw, f_lvl_abv);
+   }
+
+   return;
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 int VxPairDataPoint::get_n_pair() const {
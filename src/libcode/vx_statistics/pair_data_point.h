@@ -244,6 +244,11 @@ class VxPairDataPoint {
                          const char *, float *, Grid &, const char * = 0,
                          const DataPlane * = 0);
 
+      void compute_interp_values(int, double, double, double, double,
+                                 double, double, const char *, const Grid &,
+                                 bool, int, int, int, int, int, int,
+                                 double &, double &, double &);
+
       void add_prec_point_obs(float *, const char *, const char *, unixtime,
                               const char *, float *, Grid &, int month, int hour,
                               const char * = 0, const DataPlane * = 0);
@@ -150,8 +150,6 @@ void read_climo_file(const char *climo_file, GrdFileType ctype,
                      int day_ts, int hour_ts, const Grid &vx_grid,
                      const RegridInfo &regrid_info,
                      DataPlaneArray &dpa) {
-
-   Met2dDataFileFactory mtddf_factory;
    Met2dDataFile *mtddf = (Met2dDataFile *) 0;
 
    VarInfoFactory info_factory;
@@ -165,7 +163,7 @@ void read_climo_file(const char *climo_file, GrdFileType ctype,
    ConcatString clm_ut_cs;
 
    // Allocate memory for data file
-   if(!(mtddf = mtddf_factory.new_met_2d_data_file(climo_file, ctype))) {
+   if(!(mtddf = mtddf_cache.get(climo_file, ctype))) {
       mlog << Warning << "\nread_climo_file() -> "
            << "Trouble reading climatology file \""
            << climo_file << "\"\n\n";
@@ -240,7 +238,7 @@ void read_climo_file(const char *climo_file, GrdFileType ctype,
    } // end for i
 
    // Deallocate memory
-   if(mtddf) { delete mtddf; mtddf = (Met2dDataFile *) 0; }
+   mtddf_cache.release(mtddf);
    if(info)  { delete info;  info  = (VarInfo       *) 0; }
 
    return;
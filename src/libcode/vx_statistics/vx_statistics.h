@@ -30,6 +30,7 @@
 #include "pair_data_ensemble.h"
 #include "read_climo.h"
 #include "obs_error.h"
+#include "obs_router.h"
 
 
 ////////////////////////////////////////////////////////////////////////
@@ -16,10 +16,17 @@ using namespace std;
 #include <string.h>
 #include <cstdio>
 #include <cmath>
+#include <algorithm>
 
 #include "math_constants.h"
 #include "track_info.h"
 
+////////////////////////////////////////////////////////////////////////
+
+static string track_index_key(const ConcatString &basin,
+                              const ConcatString &cyclone,
+                              const ConcatString &technique);
+
 ////////////////////////////////////////////////////////////////////////
 //
 //  Code for class TrackInfo
@@ -767,6 +774,8 @@ void TrackInfoArray::init_from_scratch() {
 void TrackInfoArray::clear() {
 
    Track.clear();
+   TrackIndex.clear();
+   TrackLineSet.clear();
 
    return;
 }
@@ -827,6 +836,9 @@ void TrackInfoArray::assign(const TrackInfoArray &t) {
 
    for(i=0; i<t.n(); i++) Track.push_back(t[i]);
 
+   TrackIndex   = t.TrackIndex;
+   TrackLineSet = t.TrackLineSet;
+
    return;
 }
 
@@ -850,6 +862,8 @@ void TrackInfoArray::add(const TrackInfo &t) {
 
    Track.push_back(t);
 
+   index_track(Track.size()-1);
+
    return;
 }
 
@@ -864,7 +878,20 @@ void TrackInfoArray::set(int n, const TrackInfo &t) {
       exit(1);
    }
 
-   Track[n] = t;
+   // Update the index for this track rather than rebuilding it,
+   // only moving it when its basin, cyclone, or technique changes
+   if(track_index_key(Track[n].basin(), Track[n].cyclone(),
+                      Track[n].technique()) !=
+      track_index_key(t.basin(), t.cyclone(), t.technique())) {
+      unindex_track(n);
+      Track[n] = t;
+      index_track(n);
+   }
+   else {
+      remove_track_lines(Track[n]);
+      Track[n] = t;
+      add_track_lines(Track[n]);
+   }
 
    return;
 }
@@ -874,7 +901,7 @@ void TrackInfoArray::set(int n, const TrackInfo &t) {
 bool TrackInfoArray::add(const ATCFTrackLine &l, bool check_dup, bool check_anly) {
    bool found  = false;
    bool status = false;
-   int i;
+   int i, n_lines;
 
    // Check if this ATCFTrackLine already exists in the TrackInfoArray
    if(check_dup) {
@@ -887,12 +914,25 @@ bool TrackInfoArray::add(const ATCFTrackLine &l, bool check_dup, bool check_anly
       }
    }
 
-   // Add ATCFTrackLine to an existing track if possible
-   for(i=Track.size()-1; i>=0; i--) {
-      if(Track[i].is_match(l)) {
-         found = true;
-         status = Track[i].add(l, check_dup, check_anly);
-         break;
+   // Add ATCFTrackLine to an existing track if possible, only
+   // checking the tracks for this basin, cyclone, and technique
+   map<string,vector<int>>::const_iterator it =
+      TrackIndex.find(track_index_key(l.basin(), l.cyclone_number(),
+                                      l.technique()));
+
+   if(it != TrackIndex.end()) {
+      for(vector<int>::const_reverse_iterator r = it->second.rbegin();
+          r != it->second.rend(); r++) {
+         i = *r;
+         if(Track[i].is_match(l)) {
+            found   = true;
+            n_lines = Track[i].n_track_lines();
+            status  = Track[i].add(l, check_dup, check_anly);
+            if(Track[i].n_track_lines() > n_lines) {
+               TrackLineSet.insert(l.get_line());
+            }
+            break;
+         }
       }
    }
 
@@ -901,6 +941,7 @@ bool TrackInfoArray::add(const ATCFTrackLine &l, bool check_dup, bool check_anly
       TrackInfo t;
       t.add(l, check_dup, check_anly);
       Track.push_back(t);
+      index_track(Track.size()-1);
       status = true;
    }
 
@@ -910,19 +951,9 @@ bool TrackInfoArray::add(const ATCFTrackLine &l, bool check_dup, bool check_anly
 ////////////////////////////////////////////////////////////////////////
 
 bool TrackInfoArray::has(const ATCFTrackLine &l) const {
-   bool found = false;
-   int i;
-
-   // Check if the TrackInfo data matches
-   for(i=Track.size()-1; i>=0; i--) {
-      if(Track[i].has(l)) {
-         found = true;
-         break;
-      }
-   }
 
-   // Return whether the TrackInfo matches
-   return(found);
+   // Check the lines stored by all of the tracks
+   return(TrackLineSet.find(l.get_line()) != TrackLineSet.end());
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -940,11 +971,95 @@ bool TrackInfoArray::erase_storm_id(const ConcatString &s) {
       }
    }
 
+   // Track indices have shifted
+   if(status) rebuild_index();
+
    return(status);
 }
 
 ////////////////////////////////////////////////////////////////////////
 
+void TrackInfoArray::index_track(int i) {
+   const TrackInfo &t = Track[i];
+
+   // Keep the indices sorted, which appends when adding tracks
+   vector<int> &v = TrackIndex[track_index_key(t.basin(), t.cyclone(),
+                                               t.technique())];
+   v.insert(upper_bound(v.begin(), v.end(), i), i);
+
+   add_track_lines(t);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void TrackInfoArray::unindex_track(int i) {
+   const TrackInfo &t = Track[i];
+
+   map<string,vector<int>>::iterator it =
+      TrackIndex.find(track_index_key(t.basin(), t.cyclone(),
+                                      t.technique()));
+
+   if(it != TrackIndex.end()) {
+      vector<int>::iterator r = lower_bound(it->second.begin(),
+                                            it->second.end(), i);
+      if(r != it->second.end() && *r == i) it->second.erase(r);
+      if(it->second.empty()) TrackIndex.erase(it);
+   }
+
+   remove_track_lines(t);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void TrackInfoArray::add_track_lines(const TrackInfo &t) {
+   StringArray sa;
+   int j;
+
+   if(t.n_track_lines() > 0) {
+      sa = t.track_lines();
+      for(j=0; j<sa.n(); j++) TrackLineSet.insert(sa[j]);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void TrackInfoArray::remove_track_lines(const TrackInfo &t) {
+   multiset<string>::iterator it;
+   StringArray sa;
+   int j;
+
+   // Remove one instance of each line
+   if(t.n_track_lines() > 0) {
+      sa = t.track_lines();
+      for(j=0; j<sa.n(); j++) {
+         it = TrackLineSet.find(sa[j]);
+         if(it != TrackLineSet.end()) TrackLineSet.erase(it);
+      }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void TrackInfoArray::rebuild_index() {
+
+   TrackIndex.clear();
+   TrackLineSet.clear();
+
+   for(int i=0; i<(int) Track.size(); i++) index_track(i);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 int TrackInfoArray::add_diag_data(DiagFile &diag_file, const StringArray &diag_name) {
    int n_match = 0;
 
@@ -1256,3 +1371,22 @@ void latlon_to_xytk_err(double alat, double alon,
 }
 
 ////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////
+
+string track_index_key(const ConcatString &basin,
+                       const ConcatString &cyclone,
+                       const ConcatString &technique) {
+   string s;
+
+   // ATCF fields never contain commas
+   s  = basin.string();
+   s += ",";
+   s += cyclone.string();
+   s += ",";
+   s += technique.string();
+
+   return(s);
+}
+
+////////////////////////////////////////////////////////////////////////
@@ -14,6 +14,9 @@
 ////////////////////////////////////////////////////////////////////////
 
 #include <iostream>
+#include <map>
+#include <set>
+#include <vector>
 
 #include "vx_cal.h"
 #include "vx_math.h"
@@ -159,6 +162,7 @@ class TrackInfo {
       const char *         diag_name(int)     const;
 
       StringArray          track_lines()      const;
+      int                  n_track_lines()    const;
 
          //
          //  do stuff
@@ -220,7 +224,8 @@ inline const ConcatString & TrackInfo::field_source()     const { return(FieldSo
 inline int                  TrackInfo::n_diag()           const { return(DiagName.n()); }
 inline const StringArray &  TrackInfo::diag_name()        const { return(DiagName);     }
 
-inline StringArray          TrackInfo::track_lines()      const { return(TrackLines); }
+inline StringArray          TrackInfo::track_lines()      const { return(TrackLines);     }
+inline int                  TrackInfo::n_track_lines()    const { return(TrackLines.n()); }
 
 ////////////////////////////////////////////////////////////////////////
 //
@@ -240,6 +245,18 @@ class TrackInfoArray {
 
       std::vector<TrackInfo> Track;
 
+         // Sorted track indices keyed on basin, cyclone, and technique
+         // and the ATCF lines stored for duplicate checking, counted
+         // once for each track containing them
+      std::map<std::string,std::vector<int>> TrackIndex;
+      std::multiset<std::string> TrackLineSet;
+
+      void index_track(int);
+      void unindex_track(int);
+      void add_track_lines(const TrackInfo &);
+      void remove_track_lines(const TrackInfo &);
+      void rebuild_index();
+
    public:
 
       TrackInfoArray();
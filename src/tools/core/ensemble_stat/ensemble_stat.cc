@@ -621,7 +621,7 @@ bool get_data_plane(const char *infile, GrdFileType ftype,
    Met2dDataFile *mtddf = (Met2dDataFile *) 0;
 
    // Read the current ensemble file
-   if(!(mtddf = mtddf_factory.new_met_2d_data_file(infile, ftype))) {
+   if(!(mtddf = mtddf_cache.get(infile, ftype))) {
       mlog << Error << "\nget_data_plane() -> "
            << "trouble reading file \"" << infile << "\"\n\n";
       exit(1);
@@ -656,8 +656,8 @@ bool get_data_plane(const char *infile, GrdFileType ftype,
 
    } // end if found
 
-   // Deallocate the data file pointer, if necessary
-   if(mtddf) { delete mtddf; mtddf = (Met2dDataFile *) 0; }
+   // Release the data file pointer
+   mtddf_cache.release(mtddf);
 
    return(found);
 }
@@ -672,7 +672,7 @@ bool get_data_plane_array(const char *infile, GrdFileType ftype,
    Met2dDataFile *mtddf = (Met2dDataFile *) 0;
 
    // Read the current ensemble file
-   if(!(mtddf = mtddf_factory.new_met_2d_data_file(infile, ftype))) {
+   if(!(mtddf = mtddf_cache.get(infile, ftype))) {
       mlog << Error << "\nget_data_plane_array() -> "
            << "trouble reading file \"" << infile << "\"\n\n";
       exit(1);
@@ -716,8 +716,8 @@ bool get_data_plane_array(const char *infile, GrdFileType ftype,
 
    } // end if found
 
-   // Deallocate the data file pointer, if necessary
-   if(mtddf) { delete mtddf; mtddf = (Met2dDataFile *) 0; }
+   // Release the data file pointer
+   mtddf_cache.release(mtddf);
 
    return(found);
 }
@@ -962,9 +962,24 @@ void process_point_obs(int i_nc) {
    // Perform GRIB table lookups, if needed
    if(!use_var_id) conf_info.process_grib_codes();
 
+   // Index the verification tasks by observation variable.
+   // Non-GRIB observation fields are offered every observation so
+   // that add_point_obs() reports the error.
+   PointObsRouter obs_router;
+   for(j=0; j<conf_info.get_n_vx(); j++) {
+      VarInfo *obs_info = conf_info.vx_opt[j].vx_pd.obs_info;
+      obs_router.add(j, (VarInfoGrib *) obs_info,
+                     obs_info->file_type() == FileType_Gb1);
+   }
+
    int hdr_count = met_point_obs->get_hdr_cnt();
    int obs_count = met_point_obs->get_obs_cnt();
 
+   // Header table, decoded when the file is read
+   MetPointHeader *header_data = met_point_obs->get_header_data();
+   int hdr_typ_idx, hdr_sid_idx;
+   int prev_header_offset = bad_data_int;
+
    mlog << Debug(2) << "Searching " << (obs_count)
         << " observations from " << (hdr_count)
         << " header messages.\n";
@@ -977,7 +992,6 @@ void process_point_obs(int i_nc) {
    int  hdr_typ_arr[HDR_TYPE_ARR_LEN];
    ConcatString hdr_typ_str;
    ConcatString hdr_sid_str;
-   ConcatString hdr_vld_str;
    ConcatString obs_qty_str;
    ConcatString var_name;
    StringArray var_names;
@@ -1024,19 +1038,17 @@ void process_point_obs(int i_nc) {
 
          // Read the corresponding header array for this observation
          // - the corresponding header type, header Station ID, and valid time
-#ifdef WITH_PYTHON
-         if (use_python)
-            met_point_obs->get_header(headerOffset, hdr_arr, hdr_typ_str, hdr_sid_str, hdr_vld_str);
-         else
-#endif
-            nc_point_obs.get_header(headerOffset, hdr_arr, hdr_typ_str,
-                                    hdr_sid_str, hdr_vld_str);
+         if(headerOffset != prev_header_offset) {
+            met_point_obs->get_header(headerOffset, hdr_arr,
+                                      hdr_typ_idx, hdr_sid_idx, hdr_ut);
+            hdr_typ_str = header_data->typ_array[hdr_typ_idx];
+            hdr_sid_str = header_data->sid_array[hdr_sid_idx];
 
-         // Read the header integer types
-         met_point_obs->get_header_type(headerOffset, hdr_typ_arr);
+            // Read the header integer types
+            met_point_obs->get_header_type(headerOffset, hdr_typ_arr);
 
-         // Convert string to a unixtime
-         hdr_ut = timestring_to_unix(hdr_vld_str.c_str());
+            prev_header_offset = headerOffset;
+         }
 
          int grib_code = met_point_obs->get_grib_code_or_var_index(obs_arr);
          if (use_var_id && grib_code < var_names.n()) {
@@ -1046,9 +1058,11 @@ void process_point_obs(int i_nc) {
             var_name = "";
          }
 
-         // Check each conf_info.vx_pd object to see if this observation
-         // should be added
-         for(j=0; j<conf_info.get_n_vx(); j++) {
+         // Check each conf_info.vx_pd object which could use this
+         // observation to see if it should be added
+         const IntArray &vx_route = obs_router.lookup(var_name.c_str(), obs_arr[1]);
+         for(int i_route=0; i_route<vx_route.n(); i_route++) {
+            j = vx_route[i_route];
 
             // Attempt to add the observation to the vx_pd object
             conf_info.vx_opt[j].vx_pd.add_point_obs(
@@ -2748,6 +2762,9 @@ void clean_up() {
            << "Output file: " << out_nc_file << "\n";
    }
 
+   // Close any cached data files
+   mtddf_cache.clear();
+
    return;
 }
 
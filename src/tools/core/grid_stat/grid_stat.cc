@@ -1373,6 +1373,11 @@ void process_scores() {
          // Pointer to current interpolation object
          NbrhdInfo * nbrhd = &conf_info.vx_opt[i].nbrhd_info;
 
+         // Threshold counts for each category threshold, reused for
+         // each of the neighborhood widths
+         vector<CoverageCounts> fcst_cc(conf_info.vx_opt[i].fcat_ta.n());
+         vector<CoverageCounts> obs_cc (conf_info.vx_opt[i].ocat_ta.n());
+
          // Initialize
          for(j=0; j<n_cov; j++) nbrcts_info[j].clear();
 
@@ -1421,12 +1426,20 @@ void process_scores() {
                      if(fcst_dp_smooth.is_empty() ||
                         conf_info.vx_opt[i].fcat_ta[k].need_perc()) {
 
+                        // Apply the threshold, unless already done
+                        // for a previous width.  Percentile thresholds
+                        // change with the mask.
+                        if(fcst_cc[k].is_empty() ||
+                           conf_info.vx_opt[i].fcat_ta[k].need_perc()) {
+                           fcst_cc[k].set(fcst_dp,
+                                        conf_info.vx_opt[i].fcat_ta[k],
+                                        &cmn_dp, &csd_dp);
+                        }
+
                         // Compute fractional coverage
-                        fractional_coverage(fcst_dp, fcst_dp_smooth,
+                        fcst_cc[k].fractional_coverage(fcst_dp_smooth,
                                             nbrhd->width[j], nbrhd->shape,
                                             grid.wrap_lon(),
-                                            conf_info.vx_opt[i].fcat_ta[k],
-                                            &cmn_dp, &csd_dp,
                                             nbrhd->vld_thresh);
 
                         // Compute the binary threshold field
@@ -1461,12 +1474,20 @@ void process_scores() {
                      if(obs_dp_smooth.is_empty() ||
                         conf_info.vx_opt[i].ocat_ta[k].need_perc()) {
 
+                        // Apply the threshold, unless already done
+                        // for a previous width.  Percentile thresholds
+                        // change with the mask.
+                        if(obs_cc[k].is_empty() ||
+                           conf_info.vx_opt[i].ocat_ta[k].need_perc()) {
+                           obs_cc[k].set(obs_dp,
+                                        conf_info.vx_opt[i].ocat_ta[k],
+                                        &cmn_dp, &csd_dp);
+                        }
+
                         // Compute fractional coverage
-                        fractional_coverage(obs_dp, obs_dp_smooth,
+                        obs_cc[k].fractional_coverage(obs_dp_smooth,
                                             nbrhd->width[j], nbrhd->shape,
                                             grid.wrap_lon(),
-                                            conf_info.vx_opt[i].ocat_ta[k],
-                                            &cmn_dp, &csd_dp,
                                             nbrhd->vld_thresh);
 
                         // Compute the binary threshold field
@@ -1928,7 +1949,7 @@ void do_cts(CTSInfo *&cts_info, int i_vx,
          conf_info.vx_opt[i_vx].boot_info.n_rep,
          cts_info, n_cts,
          conf_info.vx_opt[i_vx].output_flag[i_cts] != STATOutputType_None,
-         conf_info.vx_opt[i_vx].rank_corr_flag, conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].rank_corr_flag);
    }
    else {
       compute_cts_stats_ci_perc(rng_ptr, *pd_ptr,
@@ -1936,7 +1957,7 @@ void do_cts(CTSInfo *&cts_info, int i_vx,
          conf_info.vx_opt[i_vx].boot_info.rep_prop,
          cts_info, n_cts,
          conf_info.vx_opt[i_vx].output_flag[i_cts] != STATOutputType_None,
-         conf_info.vx_opt[i_vx].rank_corr_flag, conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].rank_corr_flag);
    }
 
    return;
@@ -1977,7 +1998,7 @@ void do_mcts(MCTSInfo &mcts_info, int i_vx,
          conf_info.vx_opt[i_vx].boot_info.n_rep,
          mcts_info,
          conf_info.vx_opt[i_vx].output_flag[i_mcts] != STATOutputType_None,
-         conf_info.vx_opt[i_vx].rank_corr_flag, conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].rank_corr_flag);
    }
    else {
       compute_mcts_stats_ci_perc(rng_ptr, *pd_ptr,
@@ -1985,7 +2006,7 @@ void do_mcts(MCTSInfo &mcts_info, int i_vx,
          conf_info.vx_opt[i_vx].boot_info.rep_prop,
          mcts_info,
          conf_info.vx_opt[i_vx].output_flag[i_mcts] != STATOutputType_None,
-         conf_info.vx_opt[i_vx].rank_corr_flag, conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].rank_corr_flag);
    }
 
    return;
@@ -2103,14 +2124,14 @@ void do_cnt_sl1l2(const GridStatVxOpt &vx_opt, const PairDataPoint *pd_ptr) {
                compute_cnt_stats_ci_bca(rng_ptr, pd,
                   precip_flag, vx_opt.rank_corr_flag,
                   vx_opt.boot_info.n_rep,
-                  cnt_info[j], conf_info.tmp_dir.c_str());
+                  cnt_info[j]);
             }
             else {
                compute_cnt_stats_ci_perc(rng_ptr, pd,
                   precip_flag, vx_opt.rank_corr_flag,
                   vx_opt.boot_info.n_rep,
                   vx_opt.boot_info.rep_prop,
-                  cnt_info[j], conf_info.tmp_dir.c_str());
+                  cnt_info[j]);
             }
 
             // Write out CNT
@@ -2405,16 +2426,14 @@ void do_nbrcts(NBRCTSInfo *&nbrcts_info,
       compute_nbrcts_stats_ci_bca(rng_ptr, *pd_ptr,
          conf_info.vx_opt[i_vx].boot_info.n_rep,
          nbrcts_info, n_nbrcts,
-         conf_info.vx_opt[i_vx].output_flag[i_nbrcts] != STATOutputType_None,
-         conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].output_flag[i_nbrcts] != STATOutputType_None);
    }
    else {
       compute_nbrcts_stats_ci_perc(rng_ptr, *pd_ptr,
          conf_info.vx_opt[i_vx].boot_info.n_rep,
          conf_info.vx_opt[i_vx].boot_info.rep_prop,
          nbrcts_info, n_nbrcts,
-         conf_info.vx_opt[i_vx].output_flag[i_nbrcts] != STATOutputType_None,
-         conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].output_flag[i_nbrcts] != STATOutputType_None);
    }
 
    return;
@@ -2466,16 +2485,14 @@ void do_nbrcnt(NBRCNTInfo &nbrcnt_info,
       compute_nbrcnt_stats_ci_bca(rng_ptr, *pd_ptr, *pd_thr_ptr,
          conf_info.vx_opt[i_vx].boot_info.n_rep,
          nbrcnt_info,
-         conf_info.vx_opt[i_vx].output_flag[i_nbrcnt] != STATOutputType_None,
-         conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].output_flag[i_nbrcnt] != STATOutputType_None);
    }
    else {
       compute_nbrcnt_stats_ci_perc(rng_ptr, *pd_ptr, *pd_thr_ptr,
          conf_info.vx_opt[i_vx].boot_info.n_rep,
          conf_info.vx_opt[i_vx].boot_info.rep_prop,
          nbrcnt_info,
-         conf_info.vx_opt[i_vx].output_flag[i_nbrcnt] != STATOutputType_None,
-         conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].output_flag[i_nbrcnt] != STATOutputType_None);
    }
 
    return;
@@ -3012,6 +3029,9 @@ void clean_up() {
    // Deallocate memory for the random number generator
    rng_free(rng_ptr);
 
+   // Close any cached data files
+   mtddf_cache.clear();
+
    return;
 }
 
@@ -673,7 +673,6 @@ void process_obs_file(int i_nc) {
    float prev_obs_arr[OBS_ARRAY_LEN];
    ConcatString hdr_typ_str;
    ConcatString hdr_sid_str;
-   ConcatString hdr_vld_str;
    ConcatString obs_qty_str;
    unixtime hdr_ut;
    NcFile *obs_in = (NcFile *) 0;
@@ -746,8 +745,28 @@ void process_obs_file(int i_nc) {
    if(!use_var_id) conf_info.process_grib_codes();
    is_vgrd = is_ugrd = false;
 
+   // Index the verification tasks by observation variable.
+   // Station ID filtering is applied before the variable check, so
+   // tasks with station ID filters are offered every observation.
+   PointObsRouter obs_router;
+   for(j=0; j<conf_info.get_n_vx(); j++) {
+
+      // Check for no forecast fields
+      if(conf_info.vx_opt[j].vx_pd.fcst_dpa.n_planes() == 0) continue;
+
+      obs_router.add(j, conf_info.vx_opt[j].vx_pd.obs_info,
+                     conf_info.vx_opt[j].vx_pd.sid_inc_filt.n() == 0 &&
+                     conf_info.vx_opt[j].vx_pd.sid_exc_filt.n() == 0);
+   }
+
    int hdr_count = met_point_obs->get_hdr_cnt();
    int obs_count = met_point_obs->get_obs_cnt();
+
+   // Header table, decoded when the file is read
+   MetPointHeader *header_data = met_point_obs->get_header_data();
+   int hdr_typ_idx, hdr_sid_idx;
+   int prev_header_offset = bad_data_int;
+
    mlog << Debug(2)
         << "Searching " << obs_count
         << " observations from " << hdr_count
@@ -805,13 +824,13 @@ void process_obs_file(int i_nc) {
 
          // Read the corresponding header array for this observation
          // - the corresponding header type, header Station ID, and valid time
-#ifdef WITH_PYTHON
-         if (use_python)
-            met_point_obs->get_header(headerOffset, hdr_arr, hdr_typ_str, hdr_sid_str, hdr_vld_str);
-         else
-#endif
-            nc_point_obs.get_header(headerOffset, hdr_arr, hdr_typ_str,
-                                    hdr_sid_str, hdr_vld_str);
+         if(headerOffset != prev_header_offset) {
+            met_point_obs->get_header(headerOffset, hdr_arr,
+                                      hdr_typ_idx, hdr_sid_idx, hdr_ut);
+            hdr_typ_str = header_data->typ_array[hdr_typ_idx];
+            hdr_sid_str = header_data->sid_array[hdr_sid_idx];
+            prev_header_offset = headerOffset;
+         }
 
          // Store the variable name
          int org_grib_code = met_point_obs->get_grib_code_or_var_index(obs_arr);
@@ -857,15 +876,11 @@ void process_obs_file(int i_nc) {
             }
          }
 
-         // Convert string to a unixtime
-         hdr_ut = timestring_to_unix(hdr_vld_str.c_str());
-
-         // Check each conf_info.vx_pd object to see if this observation
-         // should be added
-         for(j=0; j<conf_info.get_n_vx(); j++) {
-
-            // Check for no forecast fields
-            if(conf_info.vx_opt[j].vx_pd.fcst_dpa.n_planes() == 0) continue;
+         // Check each conf_info.vx_pd object which could use this
+         // observation to see if it should be added
+         const IntArray &vx_route = obs_router.lookup(var_name.c_str(), obs_arr[1]);
+         for(int i_route=0; i_route<vx_route.n(); i_route++) {
+            j = vx_route[i_route];
 
             // Attempt to add the observation to the conf_info.vx_pd object
             conf_info.vx_opt[j].vx_pd.add_point_obs(
@@ -879,6 +894,17 @@ void process_obs_file(int i_nc) {
 
    } // end for i_block_start_idx
 
+   // Count the observations not routed to each task as tried and
+   // rejected for the variable name
+   for(j=0; j<conf_info.get_n_vx(); j++) {
+
+      // Check for no forecast fields
+      if(conf_info.vx_opt[j].vx_pd.fcst_dpa.n_planes() == 0) continue;
+
+      conf_info.vx_opt[j].vx_pd.n_try   += obs_router.n_skipped(j);
+      conf_info.vx_opt[j].vx_pd.rej_var += obs_router.n_skipped(j);
+   }
+
    // Deallocate and clean up
 #ifdef WITH_PYTHON
    if (use_python) met_point_file.close();
@@ -1336,8 +1362,7 @@ void do_cts(CTSInfo *&cts_info, int i_vx, const PairDataPoint *pd_ptr) {
          conf_info.vx_opt[i_vx].boot_info.n_rep,
          cts_info, n_cat,
          conf_info.vx_opt[i_vx].output_flag[i_cts] != STATOutputType_None,
-         conf_info.vx_opt[i_vx].rank_corr_flag,
-         conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].rank_corr_flag);
    }
    else {
       compute_cts_stats_ci_perc(rng_ptr, *pd_ptr,
@@ -1345,8 +1370,7 @@ void do_cts(CTSInfo *&cts_info, int i_vx, const PairDataPoint *pd_ptr) {
          conf_info.vx_opt[i_vx].boot_info.rep_prop,
          cts_info, n_cat,
          conf_info.vx_opt[i_vx].output_flag[i_cts] != STATOutputType_None,
-         conf_info.vx_opt[i_vx].rank_corr_flag,
-         conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].rank_corr_flag);
    }
 
    return;
@@ -1387,8 +1411,7 @@ void do_mcts(MCTSInfo &mcts_info, int i_vx, const PairDataPoint *pd_ptr) {
          conf_info.vx_opt[i_vx].boot_info.n_rep,
          mcts_info,
          conf_info.vx_opt[i_vx].output_flag[i_mcts] != STATOutputType_None,
-         conf_info.vx_opt[i_vx].rank_corr_flag,
-         conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].rank_corr_flag);
    }
    else {
       compute_mcts_stats_ci_perc(rng_ptr, *pd_ptr,
@@ -1396,8 +1419,7 @@ void do_mcts(MCTSInfo &mcts_info, int i_vx, const PairDataPoint *pd_ptr) {
          conf_info.vx_opt[i_vx].boot_info.rep_prop,
          mcts_info,
          conf_info.vx_opt[i_vx].output_flag[i_mcts] != STATOutputType_None,
-         conf_info.vx_opt[i_vx].rank_corr_flag,
-         conf_info.tmp_dir.c_str());
+         conf_info.vx_opt[i_vx].rank_corr_flag);
    }
 
    return;
@@ -1514,14 +1536,14 @@ void do_cnt_sl1l2(const PointStatVxOpt &vx_opt, const PairDataPoint *pd_ptr) {
                compute_cnt_stats_ci_bca(rng_ptr, pd,
                   precip_flag, vx_opt.rank_corr_flag,
                   vx_opt.boot_info.n_rep,
-                  cnt_info[j], conf_info.tmp_dir.c_str());
+                  cnt_info[j]);
             }
             else {
                compute_cnt_stats_ci_perc(rng_ptr, pd,
                   precip_flag, vx_opt.rank_corr_flag,
                   vx_opt.boot_info.n_rep,
                   vx_opt.boot_info.rep_prop,
-                  cnt_info[j], conf_info.tmp_dir.c_str());
+                  cnt_info[j]);
             }
 
             // Write out CNT
@@ -2147,6 +2169,9 @@ void clean_up() {
    // Deallocate memory for the random number generator
    rng_free(rng_ptr);
 
+   // Close any cached data files
+   mtddf_cache.clear();
+
    return;
 }
 
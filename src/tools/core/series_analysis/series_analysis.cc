@@ -80,6 +80,14 @@ static bool read_single_entry(VarInfo *, const ConcatString &,
                               const GrdFileType, DataPlane &, Grid &);
 
 static void process_scores();
+static void process_stream_scores();
+static void finish_scores(int, int);
+
+static void setup_stream_sums();
+static void add_stream_sums(const DataPlane &, const DataPlane &,
+                            const DataPlane &, const DataPlane &,
+                            bool, bool);
+static void clear_stream_sums();
 
 static void do_cts   (int, const PairDataPoint *);
 static void do_mcts  (int, const PairDataPoint *);
@@ -87,6 +95,21 @@ static void do_cnt   (int, const PairDataPoint *);
 static void do_sl1l2 (int, const PairDataPoint *);
 static void do_pct   (int, const PairDataPoint *);
 
+static void do_stream_cts  (int);
+static void do_stream_mcts (int);
+static void do_stream_cnt  (int);
+static void do_stream_sl1l2(int);
+static void do_stream_pct  (int);
+
+static void setup_cts_info (CTSInfo *, int);
+static void setup_mcts_info(MCTSInfo &);
+static void setup_pct_info (PCTInfo &);
+static void set_stream_sl1l2(const StreamSL1L2 &, SL1L2Info &);
+
+static void store_cts_info  (int, const CTSInfo *, int);
+static void store_mcts_info (int, const MCTSInfo &);
+static void store_pct_info  (int, const PCTInfo &);
+
 static void store_stat_fho  (int, const ConcatString &, const CTSInfo &);
 static void store_stat_ctc  (int, const ConcatString &, const CTSInfo &);
 static void store_stat_cts  (int, const ConcatString &, const CTSInfo &);
@@ -129,7 +152,8 @@ int met_main(int argc, char *argv[]) {
    process_command_line(argc, argv);
 
    // Compute the scores and write them out
-   process_scores();
+   if(conf_info.stream_flag) process_stream_scores();
+   else                      process_scores();
 
    // Close the text files and deallocate memory
    clean_up();
@@ -347,6 +371,16 @@ void process_grid(const Grid &fcst_grid, const Grid &obs_grid) {
    // Process masking regions
    conf_info.process_masks(grid);
 
+   // Accumulate partial sums for all grid points in a single pass
+   if(conf_info.stream_flag) {
+      n_reads = 1;
+      mlog << Debug(2)
+           << "Accumulating partial sums for all " << grid.nx() << " x "
+           << grid.ny() << " grid points in a single pass through the "
+           << "series.\n";
+      return;
+   }
+
    // Set the block size, if needed
    if(is_bad_data(conf_info.block_size)) conf_info.block_size = nxy;
 
@@ -647,7 +681,7 @@ bool read_single_entry(VarInfo *info, const ConcatString &cur_file,
    }
 
    // Open the data file
-   mtddf = mtddf_factory.new_met_2d_data_file(cur_file.c_str(), type);
+   mtddf = mtddf_cache.get(cur_file.c_str(), type);
 
    // Attempt to read the gridded data from the current file
    found = mtddf->data_plane(*info, dp);
@@ -655,8 +689,8 @@ bool read_single_entry(VarInfo *info, const ConcatString &cur_file,
    // Store the current grid
    if(found) cur_grid = mtddf->grid();
 
-   // Close the data file
-   delete mtddf; mtddf = (Met2dDataFile *) 0;
+   // Release the data file
+   mtddf_cache.release(mtddf);
 
    return(found);
 }
@@ -851,6 +885,362 @@ void process_scores() {
 
    } // end for i_read
 
+   // Clean up
+   if(pd_ptr) { delete [] pd_ptr; pd_ptr = (PairDataPoint *) 0; }
+
+   // Write time range information and summary counts
+   finish_scores(n_skip_zero, n_skip_pos);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Read each series entry exactly once and update per-point partial
+// sums in place. Memory usage is bounded by the size of the sums
+// rather than the number of matched pairs.
+//
+////////////////////////////////////////////////////////////////////////
+
+void process_stream_scores() {
+   int x, y, n, i_series, i_fcst;
+   VarInfo *fcst_info = (VarInfo *) 0;
+   VarInfo *obs_info  = (VarInfo *) 0;
+   DataPlane fcst_dp, obs_dp;
+
+   // Climatology mean and standard deviation
+   DataPlane cmn_dp, csd_dp;
+   bool cmn_flag, csd_flag;
+
+   // Number of points skipped due to valid data threshold
+   int n_skip_zero = 0;
+   int n_skip_pos  = 0;
+
+   // Loop over the series variable
+   for(i_series=0; i_series<n_series; i_series++) {
+
+      // Get the index for the forecast and climo VarInfo objects
+      i_fcst = (conf_info.get_n_fcst() > 1 ? i_series : 0);
+
+      // Store the current VarInfo objects
+      fcst_info = conf_info.fcst_info[i_fcst];
+      obs_info  = (conf_info.get_n_obs() > 1 ?
+                   conf_info.obs_info[i_series] :
+                   conf_info.obs_info[0]);
+
+      // Retrieve the data planes for the current series entry
+      get_series_data(i_series, fcst_info, obs_info, fcst_dp, obs_dp);
+
+      // Allocate the partial sums on the first pass
+      if(i_series == 0) setup_stream_sums();
+
+      // Read climatology data for the current series entry
+      cmn_dp = read_climo_data_plane(
+               conf_info.conf.lookup_array(conf_key_climo_mean_field, false),
+               i_fcst, fcst_dp.valid(), grid);
+      csd_dp = read_climo_data_plane(
+               conf_info.conf.lookup_array(conf_key_climo_stdev_field, false),
+               i_fcst, fcst_dp.valid(), grid);
+
+      cmn_flag = (cmn_dp.nx() == fcst_dp.nx() && cmn_dp.ny() == fcst_dp.ny());
+      csd_flag = (csd_dp.nx() == fcst_dp.nx() && csd_dp.ny() == fcst_dp.ny());
+
+      mlog << Debug(3)
+        << "Found " << (cmn_flag ? 1 : 0)
+        << " climatology mean and " << (csd_flag ? 1 : 0)
+        << " climatology standard deviation field(s) for forecast "
+        << fcst_info->magic_str() << ".\n";
+
+      // Setup the output NetCDF file on the first pass
+      if(nc_out == (NcFile *) 0) setup_nc_file(fcst_info, obs_info);
+
+      // Update timing info
+      set_range(fcst_dp.init(),  fcst_init_beg,  fcst_init_end);
+      set_range(fcst_dp.valid(), fcst_valid_beg, fcst_valid_end);
+      set_range(fcst_dp.lead(),  fcst_lead_beg,  fcst_lead_end);
+      set_range(obs_dp.init(),   obs_init_beg,   obs_init_end);
+      set_range(obs_dp.valid(),  obs_valid_beg,  obs_valid_end);
+      set_range(obs_dp.lead(),   obs_lead_beg,   obs_lead_end);
+
+      // Update the partial sums for each grid point
+      add_stream_sums(fcst_dp, obs_dp, cmn_dp, csd_dp, cmn_flag, csd_flag);
+
+   } // end for i_series
+
+   // Compute statistics for each grid point
+   for(n=0; n<nxy; n++) {
+
+      // Determine x,y location
+      DefaultTO.one_to_two(grid.nx(), grid.ny(), n, x, y);
+
+      // Check for the required number of matched pairs
+      if(stream_n_pairs[n]/(double) n_series < conf_info.vld_data_thresh) {
+         mlog << Debug(4)
+              << "Skipping point (" << x << ", " << y << ") with "
+              << stream_n_pairs[n] << " matched pairs.\n";
+
+         // Keep track of the number of points skipped
+         if(stream_n_pairs[n] == 0) n_skip_zero++;
+         else                       n_skip_pos++;
+
+         continue;
+      }
+      else {
+         mlog << Debug(4)
+              << "Processing point (" << x << ", " << y << ") with "
+              << stream_n_pairs[n] << " matched pairs.\n";
+      }
+
+      // Contingency table counts and statistics
+      if(stream_ctc.size()   > 0) do_stream_cts(n);
+
+      // Multi-category contingency table counts and statistics
+      if(stream_mctc.size()  > 0) do_stream_mcts(n);
+
+      // Continuous statistics and partial sums
+      if(stream_sl1l2.size() > 0) {
+         if(conf_info.output_stats[stat_cnt].n() > 0) do_stream_cnt(n);
+         if(conf_info.output_stats[stat_sl1l2].n()  > 0 ||
+            conf_info.output_stats[stat_sal1l2].n() > 0) do_stream_sl1l2(n);
+      }
+
+      // Probabilistic counts and statistics
+      if(stream_pct.size()   > 0) do_stream_pct(n);
+
+   } // end for n
+
+   // Clean up
+   clear_stream_sums();
+
+   // Write time range information and summary counts
+   finish_scores(n_skip_zero, n_skip_pos);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void setup_stream_sums() {
+   int i;
+   NumArray p_thresh;
+   bool is_prob = conf_info.fcst_info[0]->is_prob();
+   size_t n_cat = (size_t) conf_info.fcat_ta.n();
+
+   // Number of valid pairs for each grid point
+   stream_n_pairs.assign(nxy, 0);
+
+   // Contingency table counts
+   if(!is_prob &&
+      (conf_info.output_stats[stat_fho].n() +
+       conf_info.output_stats[stat_ctc].n() +
+       conf_info.output_stats[stat_cts].n()) > 0) {
+      stream_ctc.assign(n_cat*nxy*4, 0);
+   }
+
+   // Multi-category contingency table counts
+   if(!is_prob &&
+      (conf_info.output_stats[stat_mctc].n() +
+       conf_info.output_stats[stat_mcts].n()) > 0) {
+      stream_mctc.assign((n_cat+1)*(n_cat+1)*nxy, 0);
+   }
+
+   // Scalar partial sums
+   if(!is_prob &&
+      (conf_info.output_stats[stat_cnt].n()   +
+       conf_info.output_stats[stat_sl1l2].n() +
+       conf_info.output_stats[stat_sal1l2].n()) > 0) {
+      StreamSL1L2 zero = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0,
+                           0.0, 0.0, 0.0, 0.0, 0.0, 0 };
+      stream_sl1l2.assign((size_t) conf_info.fcnt_ta.n()*nxy, zero);
+   }
+
+   // Nx2 contingency table counts
+   if(is_prob &&
+      (conf_info.output_stats[stat_pct].n()  +
+       conf_info.output_stats[stat_pstd].n() +
+       conf_info.output_stats[stat_pjc].n()  +
+       conf_info.output_stats[stat_prc].n()) > 0) {
+
+      // Store the probability threshold values
+      for(i=0; i<conf_info.fcat_ta.n(); i++) {
+         p_thresh.add(conf_info.fcat_ta[i].get_value());
+      }
+      stream_pct_tmpl.clear();
+      stream_pct_tmpl.set_size(conf_info.fcat_ta.n()-1);
+      stream_pct_tmpl.set_thresholds(p_thresh.vals());
+
+      stream_pct.assign((size_t) conf_info.ocat_ta.n()*nxy*(n_cat-1)*2, 0);
+      stream_cpct.assign(stream_pct.size(), 0);
+   }
+
+   mlog << Debug(3)
+        << "Allocated partial sums for " << nxy << " grid points.\n";
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void add_stream_sums(const DataPlane &fcst_dp, const DataPlane &obs_dp,
+                     const DataPlane &cmn_dp,  const DataPlane &csd_dp,
+                     bool cmn_flag, bool csd_flag) {
+   int i, j, k, n, x, y, r, c, n_bin;
+   double f, o, cmn, csd;
+   NumArray cmn_na, csd_na, cprob_na;
+   vector<int> vld_n;
+
+   int n_cat = conf_info.fcat_ta.n();
+   int n_cnt = conf_info.fcnt_ta.n();
+
+   // Find the valid matched pairs
+   vld_n.reserve(nxy);
+   for(n=0; n<nxy; n++) {
+
+      // Convert n to x, y
+      DefaultTO.one_to_two(grid.nx(), grid.ny(), n, x, y);
+
+      // Skip points outside the mask and bad data
+      if(!conf_info.mask_area(x, y)              ||
+         is_bad_data(fcst_dp(x, y))              ||
+         is_bad_data(obs_dp(x,y))                ||
+         (cmn_flag && is_bad_data(cmn_dp(x, y))) ||
+         (csd_flag && is_bad_data(csd_dp(x, y)))) continue;
+
+      vld_n.push_back(n);
+      stream_n_pairs[n]++;
+
+      // Store climatology values for deriving probabilities
+      if(stream_pct.size() > 0 && cmn_flag) {
+         cmn_na.add(cmn_dp(x, y));
+         csd_na.add(csd_flag ? csd_dp(x, y) : bad_data_double);
+      }
+   }
+
+   // Update the sums for each valid matched pair
+   for(i=0; i<(int) vld_n.size(); i++) {
+
+      n = vld_n[i];
+      DefaultTO.one_to_two(grid.nx(), grid.ny(), n, x, y);
+
+      f   = fcst_dp(x, y);
+      o   = obs_dp(x, y);
+      cmn = (cmn_flag ? cmn_dp(x, y) : bad_data_double);
+      csd = (csd_flag ? csd_dp(x, y) : bad_data_double);
+
+      // Contingency table counts
+      for(j=0; j<n_cat && stream_ctc.size() > 0; j++) {
+         k  = (conf_info.fcat_ta[j].check(f, cmn, csd) ? 0 : 2);
+         k += (conf_info.ocat_ta[j].check(o, cmn, csd) ? 0 : 1);
+         stream_ctc[((size_t) j*nxy + n)*4 + k]++;
+      }
+
+      // Multi-category contingency table counts
+      if(stream_mctc.size() > 0) {
+         r = conf_info.fcat_ta.check_bins(f, cmn, csd);
+         c = conf_info.ocat_ta.check_bins(o, cmn, csd);
+         stream_mctc[((size_t) n*(n_cat+1) + r)*(n_cat+1) + c]++;
+      }
+
+      // Scalar partial sums
+      for(j=0; j<n_cnt && stream_sl1l2.size() > 0; j++) {
+
+         // Apply continuous filtering thresholds
+         if(!check_fo_thresh(f, o, cmn, csd,
+                             conf_info.fcnt_ta[j], conf_info.ocnt_ta[j],
+                             conf_info.cnt_logic)) continue;
+
+         StreamSL1L2 &s = stream_sl1l2[(size_t) j*nxy + n];
+         s.f  += f;
+         s.o  += o;
+         s.fo += f*o;
+         s.ff += f*f;
+         s.oo += o*o;
+         s.ae += fabs(f-o);
+         s.n++;
+
+         if(!is_bad_data(cmn)) {
+            s.fa  += f-cmn;
+            s.oa  += o-cmn;
+            s.foa += (f-cmn)*(o-cmn);
+            s.ffa += (f-cmn)*(f-cmn);
+            s.ooa += (o-cmn)*(o-cmn);
+            s.na++;
+         }
+      }
+   } // end for i
+
+   // Nx2 contingency table counts
+   if(stream_pct.size() > 0) {
+
+      n_bin = stream_pct_tmpl.nrows();
+
+      for(j=0; j<conf_info.ocat_ta.n(); j++) {
+
+         // Derive the climatological probabilities for this threshold
+         if(cmn_flag) {
+            cprob_na = derive_climo_prob(&conf_info.cdf_info,
+                                         cmn_na, csd_na,
+                                         conf_info.ocat_ta[j]);
+         }
+
+         for(i=0; i<(int) vld_n.size(); i++) {
+
+            n = vld_n[i];
+            DefaultTO.one_to_two(grid.nx(), grid.ny(), n, x, y);
+
+            f   = fcst_dp(x, y);
+            o   = obs_dp(x, y);
+            cmn = (cmn_flag ? cmn_dp(x, y) : bad_data_double);
+            csd = (csd_flag ? csd_dp(x, y) : bad_data_double);
+
+            // Column offset for events and non-events
+            k = (conf_info.ocat_ta[j].check(o, cmn, csd) ?
+                 nx2_event_column : nx2_nonevent_column);
+
+            // Forecast probability bin
+            if((r = stream_pct_tmpl.value_to_row(f)) < 0) {
+               mlog << Error << "\nadd_stream_sums() -> "
+                    << "bad probability value ... " << f << "\n\n";
+               exit(1);
+            }
+            stream_pct[(((size_t) j*nxy + n)*n_bin + r)*2 + k]++;
+
+            // Climatological probability bin
+            if(cmn_flag && i < cprob_na.n()) {
+               if((r = stream_pct_tmpl.value_to_row(cprob_na[i])) < 0) {
+                  mlog << Error << "\nadd_stream_sums() -> "
+                       << "bad climatological probability value ... "
+                       << cprob_na[i] << "\n\n";
+                  exit(1);
+               }
+               stream_cpct[(((size_t) j*nxy + n)*n_bin + r)*2 + k]++;
+            }
+         } // end for i
+      } // end for j
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void clear_stream_sums() {
+
+   vector<int>().swap(stream_n_pairs);
+   vector<int>().swap(stream_ctc);
+   vector<int>().swap(stream_mctc);
+   vector<StreamSL1L2>().swap(stream_sl1l2);
+   vector<int>().swap(stream_pct);
+   vector<int>().swap(stream_cpct);
+   stream_pct_tmpl.clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void finish_scores(int n_skip_zero, int n_skip_pos) {
+
    // Add time range information to the global NetCDF attributes
    add_att(nc_out, "fcst_init_beg",  (string)unix_to_yyyymmdd_hhmmss(fcst_init_beg));
    add_att(nc_out, "fcst_init_end",  (string)unix_to_yyyymmdd_hhmmss(fcst_init_end));
@@ -865,9 +1255,6 @@ void process_scores() {
    add_att(nc_out, "obs_lead_beg",   (string)sec_to_hhmmss(obs_lead_beg));
    add_att(nc_out, "obs_lead_end",   (string)sec_to_hhmmss(obs_lead_end));
 
-   // Clean up
-   if(pd_ptr) { delete [] pd_ptr; pd_ptr = (PairDataPoint *) 0; }
-
    // Print summary counts
    mlog << Debug(2)
         << "Finished processing statistics for "
@@ -894,7 +1281,6 @@ void process_scores() {
 ////////////////////////////////////////////////////////////////////////
 
 void do_cts(int n, const PairDataPoint *pd_ptr) {
-   int i, j;
 
    mlog << Debug(4) << "Computing Categorical Statistics.\n";
 
@@ -903,16 +1289,7 @@ void do_cts(int n, const PairDataPoint *pd_ptr) {
    CTSInfo *cts_info = new CTSInfo [n_cts];
 
    // Setup CTSInfo objects
-   for(i=0; i<n_cts; i++) {
-      cts_info[i].cts.set_ec_value(conf_info.hss_ec_value);
-      cts_info[i].fthresh = conf_info.fcat_ta[i];
-      cts_info[i].othresh = conf_info.ocat_ta[i];
-
-      cts_info[i].allocate_n_alpha(conf_info.ci_alpha.n());
-      for(j=0; j<conf_info.ci_alpha.n(); j++) {
-         cts_info[i].alpha[j] = conf_info.ci_alpha[j];
-      }
-   }
+   setup_cts_info(cts_info, n_cts);
 
    // Compute the counts, stats, normal confidence intervals, and
    // bootstrap confidence intervals
@@ -920,36 +1297,17 @@ void do_cts(int n, const PairDataPoint *pd_ptr) {
       compute_cts_stats_ci_bca(rng_ptr, *pd_ptr,
          conf_info.n_boot_rep,
          cts_info, n_cts, true,
-         conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
+         conf_info.rank_corr_flag);
    }
    else {
       compute_cts_stats_ci_perc(rng_ptr, *pd_ptr,
          conf_info.n_boot_rep, conf_info.boot_rep_prop,
          cts_info, n_cts, true,
-         conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
+         conf_info.rank_corr_flag);
    }
 
-   // Loop over the categorical thresholds
-   for(i=0; i<n_cts; i++) {
-
-      // Add statistic value for each possible FHO column
-      for(j=0; j<conf_info.output_stats[stat_fho].n(); j++) {
-         store_stat_fho(n, conf_info.output_stats[stat_fho][j],
-                        cts_info[i]);
-      }
-
-      // Add statistic value for each possible CTC column
-      for(j=0; j<conf_info.output_stats[stat_ctc].n(); j++) {
-         store_stat_ctc(n, conf_info.output_stats[stat_ctc][j],
-                        cts_info[i]);
-      }
-
-      // Add statistic value for each possible CTS column
-      for(j=0; j<conf_info.output_stats[stat_cts].n(); j++) {
-         store_stat_cts(n, conf_info.output_stats[stat_cts][j],
-                        cts_info[i]);
-      }
-   } // end for i
+   // Store the statistics for each categorical threshold
+   store_cts_info(n, cts_info, n_cts);
 
    // Deallocate memory
    if(cts_info) { delete [] cts_info; cts_info = (CTSInfo *) 0; }
@@ -960,7 +1318,6 @@ void do_cts(int n, const PairDataPoint *pd_ptr) {
 ////////////////////////////////////////////////////////////////////////
 
 void do_mcts(int n, const PairDataPoint *pd_ptr) {
-   int i;
 
    mlog << Debug(4) << "Computing Multi-Category Statistics.\n";
 
@@ -968,15 +1325,7 @@ void do_mcts(int n, const PairDataPoint *pd_ptr) {
    MCTSInfo mcts_info;
 
    // Setup the MCTSInfo object
-   mcts_info.cts.set_size(conf_info.fcat_ta.n() + 1);
-   mcts_info.cts.set_ec_value(conf_info.hss_ec_value);
-   mcts_info.set_fthresh(conf_info.fcat_ta);
-   mcts_info.set_othresh(conf_info.ocat_ta);
-
-   mcts_info.allocate_n_alpha(conf_info.ci_alpha.n());
-   for(i=0; i<conf_info.ci_alpha.n(); i++) {
-      mcts_info.alpha[i] = conf_info.ci_alpha[i];
-   }
+   setup_mcts_info(mcts_info);
 
    // Compute the counts, stats, normal confidence intervals, and
    // bootstrap confidence intervals
@@ -984,26 +1333,17 @@ void do_mcts(int n, const PairDataPoint *pd_ptr) {
       compute_mcts_stats_ci_bca(rng_ptr, *pd_ptr,
          conf_info.n_boot_rep,
          mcts_info, true,
-         conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
+         conf_info.rank_corr_flag);
    }
    else {
       compute_mcts_stats_ci_perc(rng_ptr, *pd_ptr,
          conf_info.n_boot_rep, conf_info.boot_rep_prop,
          mcts_info, true,
-         conf_info.rank_corr_flag, conf_info.tmp_dir.c_str());
+         conf_info.rank_corr_flag);
    }
 
-   // Add statistic value for each possible MCTC column
-   for(i=0; i<conf_info.output_stats[stat_mctc].n(); i++) {
-      store_stat_mctc(n, conf_info.output_stats[stat_mctc][i],
-                      mcts_info);
-   }
-
-   // Add statistic value for each possible MCTS column
-   for(i=0; i<conf_info.output_stats[stat_mcts].n(); i++) {
-      store_stat_mcts(n, conf_info.output_stats[stat_mcts][i],
-                      mcts_info);
-   }
+   // Store the multi-category statistics
+   store_mcts_info(n, mcts_info);
 
    return;
 }
@@ -1050,13 +1390,13 @@ void do_cnt(int n, const PairDataPoint *pd_ptr) {
          compute_cnt_stats_ci_bca(rng_ptr, pd,
             precip_flag, conf_info.rank_corr_flag,
             conf_info.n_boot_rep,
-            cnt_info, conf_info.tmp_dir.c_str());
+            cnt_info);
       }
       else {
          compute_cnt_stats_ci_perc(rng_ptr, pd,
             precip_flag, conf_info.rank_corr_flag,
             conf_info.n_boot_rep, conf_info.boot_rep_prop,
-            cnt_info, conf_info.tmp_dir.c_str());
+            cnt_info);
       }
 
       // Add statistic value for each possible CNT column
@@ -1100,7 +1440,7 @@ void do_sl1l2(int n, const PairDataPoint *pd_ptr) {
 ////////////////////////////////////////////////////////////////////////
 
 void do_pct(int n, const PairDataPoint *pd_ptr) {
-   int i, j;
+   int i;
 
    mlog << Debug(4) << "Computing Probabilistic Statistics.\n";
 
@@ -1108,12 +1448,7 @@ void do_pct(int n, const PairDataPoint *pd_ptr) {
    PCTInfo pct_info;
 
    // Setup the PCTInfo object
-   pct_info.fthresh = conf_info.fcat_ta;
-   pct_info.allocate_n_alpha(conf_info.ci_alpha.n());
-
-   for(i=0; i<conf_info.ci_alpha.n(); i++) {
-      pct_info.alpha[i] = conf_info.ci_alpha[i];
-   }
+   setup_pct_info(pct_info);
 
    // Compute PCTInfo for each observation threshold
    for(i=0; i<conf_info.ocat_ta.n(); i++) {
@@ -1124,28 +1459,328 @@ void do_pct(int n, const PairDataPoint *pd_ptr) {
       // Compute the probabilistic counts and statistics
       compute_pctinfo(*pd_ptr, true, pct_info);
 
-      // Add statistic value for each possible PCT column
-      for(j=0; j<conf_info.output_stats[stat_pct].n(); j++) {
-         store_stat_pct(n, conf_info.output_stats[stat_pct][j],
-                        pct_info);
+      // Store the probabilistic statistics
+      store_pct_info(n, pct_info);
+   } // end for i
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void do_stream_cts(int n) {
+   int i;
+   const int *c;
+
+   mlog << Debug(4) << "Computing Categorical Statistics.\n";
+
+   // Allocate objects to store categorical statistics
+   int n_cts = conf_info.fcat_ta.n();
+   CTSInfo *cts_info = new CTSInfo [n_cts];
+
+   // Setup CTSInfo objects
+   setup_cts_info(cts_info, n_cts);
+
+   // Load the accumulated counts and compute the stats and normal
+   // confidence intervals
+   for(i=0; i<n_cts; i++) {
+      c = &stream_ctc[((size_t) i*nxy + n)*4];
+      cts_info[i].cts.set_fy_oy(c[0]);
+      cts_info[i].cts.set_fy_on(c[1]);
+      cts_info[i].cts.set_fn_oy(c[2]);
+      cts_info[i].cts.set_fn_on(c[3]);
+      cts_info[i].compute_stats();
+      cts_info[i].compute_ci();
+   }
+
+   // Store the statistics for each categorical threshold
+   store_cts_info(n, cts_info, n_cts);
+
+   // Deallocate memory
+   if(cts_info) { delete [] cts_info; cts_info = (CTSInfo *) 0; }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void do_stream_mcts(int n) {
+   int r, c;
+
+   mlog << Debug(4) << "Computing Multi-Category Statistics.\n";
+
+   // Object to store multi-category statistics
+   MCTSInfo mcts_info;
+
+   // Setup the MCTSInfo object
+   setup_mcts_info(mcts_info);
+
+   // Load the accumulated counts
+   int n_cat = mcts_info.cts.nrows();
+   const int *e = &stream_mctc[(size_t) n*n_cat*n_cat];
+   for(r=0; r<n_cat; r++) {
+      for(c=0; c<n_cat; c++) mcts_info.cts.set_entry(r, c, e[r*n_cat + c]);
+   }
+
+   // Compute the stats and normal confidence intervals
+   mcts_info.compute_stats();
+   mcts_info.compute_ci();
+
+   // Store the multi-category statistics
+   store_mcts_info(n, mcts_info);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void do_stream_cnt(int n) {
+   int i, j;
+   CNTInfo cnt_info, anom_info;
+   SL1L2Info s_info;
+
+   mlog << Debug(4) << "Computing Continuous Statistics.\n";
+
+   // Process each filtering threshold
+   for(i=0; i<conf_info.fcnt_ta.n(); i++) {
+
+      // Retrieve the partial sums
+      set_stream_sl1l2(stream_sl1l2[(size_t) i*nxy + n], s_info);
+
+      // Check for no matched pairs to process
+      if(s_info.scount == 0) continue;
+
+      // Initialize
+      cnt_info.clear();
+
+      // Store thresholds
+      cnt_info.fthresh = conf_info.fcnt_ta[i];
+      cnt_info.othresh = conf_info.ocnt_ta[i];
+      cnt_info.logic   = conf_info.cnt_logic;
+
+      // Setup the CNTInfo alpha values
+      cnt_info.allocate_n_alpha(conf_info.ci_alpha.n());
+      for(j=0; j<conf_info.ci_alpha.n(); j++) {
+         cnt_info.alpha[j] = conf_info.ci_alpha[j];
+      }
+
+      // Compute the stats and normal confidence intervals
+      compute_cntinfo(s_info, false, cnt_info);
+
+      // Add the anomaly statistics when climatology is present
+      if(s_info.sacount > 0) {
+         anom_info = cnt_info;
+         compute_cntinfo(s_info, true, anom_info);
+         cnt_info.anom_corr        = anom_info.anom_corr;
+         cnt_info.rmsfa            = anom_info.rmsfa;
+         cnt_info.rmsoa            = anom_info.rmsoa;
+         cnt_info.anom_corr_uncntr = anom_info.anom_corr_uncntr;
+      }
+
+      // Add statistic value for each possible CNT column
+      for(j=0; j<conf_info.output_stats[stat_cnt].n(); j++) {
+         store_stat_cnt(n, conf_info.output_stats[stat_cnt][j],
+                        cnt_info);
+      }
+   } // end for i
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void do_stream_sl1l2(int n) {
+   int i, j;
+   SL1L2Info s_info;
+
+   mlog << Debug(4) << "Computing Scalar Partial Sums.\n";
+
+   // Loop over the continuous thresholds and retrieve the partial sums
+   for(i=0; i<conf_info.fcnt_ta.n(); i++) {
+
+      // Store thresholds
+      s_info.fthresh = conf_info.fcnt_ta[i];
+      s_info.othresh = conf_info.ocnt_ta[i];
+      s_info.logic   = conf_info.cnt_logic;
+
+      // Retrieve the partial sums
+      set_stream_sl1l2(stream_sl1l2[(size_t) i*nxy + n], s_info);
+
+      // Add statistic value for each possible SL1L2 column
+      for(j=0; j<conf_info.output_stats[stat_sl1l2].n(); j++) {
+         store_stat_sl1l2(n, conf_info.output_stats[stat_sl1l2][j], s_info);
+      }
+   } // end for i
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void do_stream_pct(int n) {
+   int i, j, n_bin;
+   const int *p, *cp;
+
+   mlog << Debug(4) << "Computing Probabilistic Statistics.\n";
+
+   // Object to store probabilistic statistics
+   PCTInfo pct_info;
+
+   // Setup the PCTInfo object
+   setup_pct_info(pct_info);
+
+   n_bin = stream_pct_tmpl.nrows();
+
+   // Compute PCTInfo for each observation threshold
+   for(i=0; i<conf_info.ocat_ta.n(); i++) {
+
+      // Set the current observation threshold
+      pct_info.othresh = conf_info.ocat_ta[i];
+
+      // Load the accumulated forecast and climatology counts
+      pct_info.pct       = stream_pct_tmpl;
+      pct_info.climo_pct = stream_pct_tmpl;
+
+      p  = &stream_pct [((size_t) i*nxy + n)*n_bin*2];
+      cp = &stream_cpct[((size_t) i*nxy + n)*n_bin*2];
+      for(j=0; j<n_bin; j++) {
+         pct_info.pct.set_entry(j, nx2_event_column,          p[2*j]);
+         pct_info.pct.set_entry(j, nx2_nonevent_column,       p[2*j+1]);
+         pct_info.climo_pct.set_entry(j, nx2_event_column,    cp[2*j]);
+         pct_info.climo_pct.set_entry(j, nx2_nonevent_column, cp[2*j+1]);
+      }
+
+      // Compute the probabilistic stats and confidence intervals
+      pct_info.compute_stats();
+      pct_info.compute_ci();
+
+      // Store the probabilistic statistics
+      store_pct_info(n, pct_info);
+   } // end for i
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void setup_cts_info(CTSInfo *cts_info, int n_cts) {
+   int i, j;
+
+   for(i=0; i<n_cts; i++) {
+      cts_info[i].cts.set_ec_value(conf_info.hss_ec_value);
+      cts_info[i].fthresh = conf_info.fcat_ta[i];
+      cts_info[i].othresh = conf_info.ocat_ta[i];
+
+      cts_info[i].allocate_n_alpha(conf_info.ci_alpha.n());
+      for(j=0; j<conf_info.ci_alpha.n(); j++) {
+         cts_info[i].alpha[j] = conf_info.ci_alpha[j];
       }
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void setup_mcts_info(MCTSInfo &mcts_info) {
+   int i;
+
+   mcts_info.cts.set_size(conf_info.fcat_ta.n() + 1);
+   mcts_info.cts.set_ec_value(conf_info.hss_ec_value);
+   mcts_info.set_fthresh(conf_info.fcat_ta);
+   mcts_info.set_othresh(conf_info.ocat_ta);
+
+   mcts_info.allocate_n_alpha(conf_info.ci_alpha.n());
+   for(i=0; i<conf_info.ci_alpha.n(); i++) {
+      mcts_info.alpha[i] = conf_info.ci_alpha[i];
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void setup_pct_info(PCTInfo &pct_info) {
+   int i;
+
+   pct_info.fthresh = conf_info.fcat_ta;
+   pct_info.allocate_n_alpha(conf_info.ci_alpha.n());
+
+   for(i=0; i<conf_info.ci_alpha.n(); i++) {
+      pct_info.alpha[i] = conf_info.ci_alpha[i];
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Convert running sums into the weighted means stored by SL1L2Info,
+// consistent with SL1L2Info::set() using the default grid weight.
+//
+////////////////////////////////////////////////////////////////////////
+
+void set_stream_sl1l2(const StreamSL1L2 &s, SL1L2Info &s_info) {
+
+   // Initialize
+   s_info.zero_out();
+
+   // Check for no matched pairs to process
+   if(s.n == 0) return;
+
+   // SL1L2 sums
+   s_info.fbar   = s.f  / s.n;
+   s_info.obar   = s.o  / s.n;
+   s_info.fobar  = s.fo / s.n;
+   s_info.ffbar  = s.ff / s.n;
+   s_info.oobar  = s.oo / s.n;
+   s_info.mae    = s.ae / s.n;
+   s_info.scount = s.n;
+
+   // SAL1L2 sums
+   if(s.na == 0) {
+      s_info.fabar  = bad_data_double;
+      s_info.oabar  = bad_data_double;
+      s_info.foabar = bad_data_double;
+      s_info.ffabar = bad_data_double;
+      s_info.ooabar = bad_data_double;
+   }
+   else {
+      s_info.fabar  = s.fa  / s.n;
+      s_info.oabar  = s.oa  / s.n;
+      s_info.foabar = s.foa / s.n;
+      s_info.ffabar = s.ffa / s.n;
+      s_info.ooabar = s.ooa / s.n;
+   }
+   s_info.sacount = s.na;
+
+   return;
+}
 
-      // Add statistic value for each possible PSTD column
-      for(j=0; j<conf_info.output_stats[stat_pstd].n(); j++) {
-         store_stat_pstd(n, conf_info.output_stats[stat_pstd][j],
-                         pct_info);
+////////////////////////////////////////////////////////////////////////
+
+void store_cts_info(int n, const CTSInfo *cts_info, int n_cts) {
+   int i, j;
+
+   // Loop over the categorical thresholds
+   for(i=0; i<n_cts; i++) {
+
+      // Add statistic value for each possible FHO column
+      for(j=0; j<conf_info.output_stats[stat_fho].n(); j++) {
+         store_stat_fho(n, conf_info.output_stats[stat_fho][j],
+                        cts_info[i]);
       }
 
-      // Add statistic value for each possible PJC column
-      for(j=0; j<conf_info.output_stats[stat_pjc].n(); j++) {
-         store_stat_pjc(n, conf_info.output_stats[stat_pjc][j],
-                        pct_info);
+      // Add statistic value for each possible CTC column
+      for(j=0; j<conf_info.output_stats[stat_ctc].n(); j++) {
+         store_stat_ctc(n, conf_info.output_stats[stat_ctc][j],
+                        cts_info[i]);
       }
 
-      // Add statistic value for each possible PRC column
-      for(j=0; j<conf_info.output_stats[stat_prc].n(); j++) {
-         store_stat_prc(n, conf_info.output_stats[stat_prc][j],
-                        pct_info);
+      // Add statistic value for each possible CTS column
+      for(j=0; j<conf_info.output_stats[stat_cts].n(); j++) {
+         store_stat_cts(n, conf_info.output_stats[stat_cts][j],
+                        cts_info[i]);
       }
    } // end for i
 
@@ -1154,6 +1789,58 @@ void do_pct(int n, const PairDataPoint *pd_ptr) {
 
 ////////////////////////////////////////////////////////////////////////
 
+void store_mcts_info(int n, const MCTSInfo &mcts_info) {
+   int i;
+
+   // Add statistic value for each possible MCTC column
+   for(i=0; i<conf_info.output_stats[stat_mctc].n(); i++) {
+      store_stat_mctc(n, conf_info.output_stats[stat_mctc][i],
+                      mcts_info);
+   }
+
+   // Add statistic value for each possible MCTS column
+   for(i=0; i<conf_info.output_stats[stat_mcts].n(); i++) {
+      store_stat_mcts(n, conf_info.output_stats[stat_mcts][i],
+                      mcts_info);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void store_pct_info(int n, const PCTInfo &pct_info) {
+   int i;
+
+   // Add statistic value for each possible PCT column
+   for(i=0; i<conf_info.output_stats[stat_pct].n(); i++) {
+      store_stat_pct(n, conf_info.output_stats[stat_pct][i],
+                     pct_info);
+   }
+
+   // Add statistic value for each possible PSTD column
+   for(i=0; i<conf_info.output_stats[stat_pstd].n(); i++) {
+      store_stat_pstd(n, conf_info.output_stats[stat_pstd][i],
+                      pct_info);
+   }
+
+   // Add statistic value for each possible PJC column
+   for(i=0; i<conf_info.output_stats[stat_pjc].n(); i++) {
+      store_stat_pjc(n, conf_info.output_stats[stat_pjc][i],
+                     pct_info);
+   }
+
+   // Add statistic value for each possible PRC column
+   for(i=0; i<conf_info.output_stats[stat_prc].n(); i++) {
+      store_stat_prc(n, conf_info.output_stats[stat_prc][i],
+                     pct_info);
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void store_stat_fho(int n, const ConcatString &col,
                     const CTSInfo &cts_info) {
    double v;
@@ -2236,6 +2923,9 @@ void clean_up() {
    // Deallocate memory for the random number generator
    rng_free(rng_ptr);
 
+   // Close any cached data files
+   mtddf_cache.clear();
+
    return;
 }
 
@@ -37,6 +37,7 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <vector>
 
 #include <netcdf>
 
@@ -132,6 +133,35 @@ static SeriesType series_type = SeriesType_None;
 // Series length
 static int n_series = 0;
 
+////////////////////////////////////////////////////////////////////////
+//
+// Variables for the single-pass streaming mode
+//
+////////////////////////////////////////////////////////////////////////
+
+// Running scalar partial sums for one grid point and threshold
+struct StreamSL1L2 {
+   double f, o, fo, ff, oo, ae;        // SL1L2 sums
+   int    n;
+   double fa, oa, foa, ffa, ooa;       // SAL1L2 sums
+   int    na;
+};
+
+// Number of valid matched pairs for each grid point [nxy]
+static std::vector<int> stream_n_pairs;
+
+// Contingency table counts for each threshold and grid point
+static std::vector<int> stream_ctc;    // [n_cat][nxy][4]
+static std::vector<int> stream_mctc;   // [nxy][n_cat+1][n_cat+1]
+
+// Scalar partial sums for each threshold and grid point
+static std::vector<StreamSL1L2> stream_sl1l2; // [n_cnt][nxy]
+
+// Nx2 contingency table counts for each threshold and grid point
+static std::vector<int> stream_pct;    // [n_ocat][nxy][n_bin][2]
+static std::vector<int> stream_cpct;   // [n_ocat][nxy][n_bin][2]
+static Nx2ContingencyTable stream_pct_tmpl;
+
 // Range of timing values encountered in the data
 static unixtime fcst_init_beg  = (unixtime) 0;
 static unixtime fcst_init_end  = (unixtime) 0;
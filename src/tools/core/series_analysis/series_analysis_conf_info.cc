@@ -81,6 +81,7 @@ void SeriesAnalysisConfInfo::clear() {
    mask_poly_name.clear();
    mask_area.clear();
    block_size = bad_data_int;
+   stream_flag = false;
    vld_data_thresh = bad_data_double;
    hss_ec_value = bad_data_double;
    rank_corr_flag = false;
@@ -438,9 +439,63 @@ void SeriesAnalysisConfInfo::process_config(GrdFileType ftype,
    // Conf: tmp_dir
    tmp_dir = parse_conf_tmp_dir(&conf);
 
+   // Conf: stream_flag
+   stream_flag = conf.lookup_bool(conf_key_stream_flag);
+
+   // Fall back to block processing for statistics which cannot be
+   // derived from partial sums
+   if(stream_flag && !is_streamable()) {
+      mlog << Warning << "\nSeriesAnalysisConfInfo::process_config() -> "
+           << "the \"" << conf_key_stream_flag << "\" option only supports "
+           << "output statistics which can be derived from partial sums "
+           << "(no rank, percentile, or bootstrap CNT statistics).\n"
+           << "Processing the data in blocks of \"" << conf_key_block_size
+           << "\" grid points instead.\n\n";
+      stream_flag = false;
+   }
+
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Check whether all of the requested output statistics can be derived
+// from running partial sums accumulated in a single pass through the
+// series, rather than from the full set of matched pairs.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool SeriesAnalysisConfInfo::is_streamable() const {
+   int i, j;
+   ConcatString c, cs;
+   map<STATLineType,StringArray>::const_iterator it;
+   const char *cnt_pairs_only[] = {
+      "SP_CORR", "KT_CORR", "RANKS", "FRANK_TIES", "ORANK_TIES",
+      "E10", "E25", "E50", "E75", "E90", "EIQR", "MAD"
+   };
+   const int n_cnt_pairs_only = sizeof(cnt_pairs_only)/sizeof(*cnt_pairs_only);
+
+   for(it = output_stats.begin(); it != output_stats.end(); it++) {
+      for(i=0; i<it->second.n(); i++) {
+
+         c = to_upper(it->second[i]);
+
+         // Bootstrap confidence intervals require the matched pairs
+         if(n_boot_rep > 0 && strstr(c.c_str(), "_BC")) return(false);
+
+         // Rank and error percentile statistics require the matched pairs
+         if(it->first != stat_cnt) continue;
+
+         for(j=0; j<n_cnt_pairs_only; j++) {
+            cs << cs_erase << cnt_pairs_only[j] << "_";
+            if(c == cnt_pairs_only[j] || c.startswith(cs.c_str())) return(false);
+         }
+      }
+   }
+
+   return(true);
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 void SeriesAnalysisConfInfo::process_masks(const Grid &grid) {
@@ -73,6 +73,7 @@ class SeriesAnalysisConfInfo {
       MaskPlane        mask_area;
 
       int              block_size;         // Number of grid points to read concurrently
+      bool             stream_flag;        // Flag for single-pass accumulation of partial sums
       double           vld_data_thresh;    // Minimum valid data ratio for each point
       double           hss_ec_value;       // HSS expected correct value
       bool             rank_corr_flag;     // Flag for computing rank correlations
@@ -91,6 +92,7 @@ class SeriesAnalysisConfInfo {
       void read_config   (const char *, const char *);
       void process_config(GrdFileType, GrdFileType);
       void process_masks (const Grid &);
+      bool is_streamable () const;
       int get_compression_level();
 
       // Dump out the counts
@@ -3859,8 +3859,7 @@ void mpr_to_ctc(STATAnalysisJob &job, const AggrMPRInfo &info,
 ////////////////////////////////////////////////////////////////////////
 
 void mpr_to_cts(STATAnalysisJob &job, const AggrMPRInfo &info,
-                int i_thresh, CTSInfo &cts_info,
-                const char *tmp_dir, gsl_rng *rng_ptr) {
+                int i_thresh, CTSInfo &cts_info, gsl_rng *rng_ptr) {
    CTSInfo *cts_info_ptr = (CTSInfo *) 0;
 
    //
@@ -3891,13 +3890,13 @@ void mpr_to_cts(STATAnalysisJob &job, const AggrMPRInfo &info,
       compute_cts_stats_ci_bca(rng_ptr, info.pd,
          job.n_boot_rep,
          cts_info_ptr, 1, 1,
-         job.rank_corr_flag, tmp_dir);
+         job.rank_corr_flag);
    }
    else {
       compute_cts_stats_ci_perc(rng_ptr, info.pd,
          job.n_boot_rep, job.boot_rep_prop,
          cts_info_ptr, 1, 1,
-         job.rank_corr_flag, tmp_dir);
+         job.rank_corr_flag);
    }
 
    return;
@@ -3930,8 +3929,7 @@ void mpr_to_mctc(STATAnalysisJob &job, const AggrMPRInfo &info,
 ////////////////////////////////////////////////////////////////////////
 
 void mpr_to_mcts(STATAnalysisJob &job, const AggrMPRInfo &info,
-                 MCTSInfo &mcts_info, const char *tmp_dir,
-                 gsl_rng *rng_ptr) {
+                 MCTSInfo &mcts_info, gsl_rng *rng_ptr) {
 
    //
    // Initialize
@@ -3961,13 +3959,13 @@ void mpr_to_mcts(STATAnalysisJob &job, const AggrMPRInfo &info,
       compute_mcts_stats_ci_bca(rng_ptr, info.pd,
          job.n_boot_rep,
          mcts_info, 1,
-         job.rank_corr_flag, tmp_dir);
+         job.rank_corr_flag);
    }
    else {
       compute_mcts_stats_ci_perc(rng_ptr, info.pd,
          job.n_boot_rep, job.boot_rep_prop,
          mcts_info, 1,
-         job.rank_corr_flag, tmp_dir);
+         job.rank_corr_flag);
    }
 
    return;
@@ -3976,8 +3974,7 @@ void mpr_to_mcts(STATAnalysisJob &job, const AggrMPRInfo &info,
 ////////////////////////////////////////////////////////////////////////
 
 void mpr_to_cnt(STATAnalysisJob &job, const AggrMPRInfo &info,
-                int i_thresh, CNTInfo &cnt_info, const char *tmp_dir,
-                gsl_rng *rng_ptr) {
+                int i_thresh, CNTInfo &cnt_info, gsl_rng *rng_ptr) {
    PairDataPoint pd_thr;
    bool precip_flag = false;
    NumArray w_na;
@@ -4028,13 +4025,13 @@ void mpr_to_cnt(STATAnalysisJob &job, const AggrMPRInfo &info,
 
       compute_cnt_stats_ci_bca(rng_ptr, pd_thr,
          precip_flag, job.rank_corr_flag, job.n_boot_rep,
-         cnt_info, tmp_dir);
+         cnt_info);
    }
    else {
 
       compute_cnt_stats_ci_perc(rng_ptr, pd_thr,
          precip_flag, job.rank_corr_flag, job.n_boot_rep, job.boot_rep_prop,
-         cnt_info, tmp_dir);
+         cnt_info);
    }
 
    return;
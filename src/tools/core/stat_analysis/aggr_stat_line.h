@@ -328,7 +328,7 @@ extern void mpr_to_ctc(
 
 extern void mpr_to_cts(
                STATAnalysisJob &, const AggrMPRInfo &,
-               int, CTSInfo &, const char *, gsl_rng *);
+               int, CTSInfo &, gsl_rng *);
 
 extern void mpr_to_mctc(
                STATAnalysisJob &, const AggrMPRInfo &,
@@ -336,11 +336,11 @@ extern void mpr_to_mctc(
 
 extern void mpr_to_mcts(
                STATAnalysisJob &, const AggrMPRInfo &,
-               MCTSInfo &, const char *, gsl_rng *);
+               MCTSInfo &, gsl_rng *);
 
 extern void mpr_to_cnt(
                STATAnalysisJob &, const AggrMPRInfo &,
-               int, CNTInfo &, const char *, gsl_rng *);
+               int, CNTInfo &, gsl_rng *);
 
 extern void mpr_to_psum(STATAnalysisJob &, const AggrMPRInfo &,
                int, SL1L2Info &);
@@ -90,15 +90,21 @@ static void usage();
 static void set_lookin_path(const StringArray &);
 static void set_out_filename(const StringArray &);
 static void set_tmp_dir(const StringArray &);
+static void set_cache(const StringArray &);
 static void set_config_file(const StringArray &);
 static void process_search_dirs();
 static void process_stat_file(const char *, const STATAnalysisJob &, int &, int &);
+static void process_stat_cache(const char *, STATCache &, const STATAnalysisJob &, int &, int &);
 
 #ifdef WITH_PYTHON
 static void process_python(const STATAnalysisJob &);
 #endif
 
-static void process_job(const char *, int);
+static void amend_ss_index_default_job();
+static void setup_jobs();
+static void setup_job(const char *, int, STATAnalysisJob &);
+static bool is_prefilter_job(const STATAnalysisJob &);
+static void process_job(int);
 static void clean_up();
 
 //
@@ -109,13 +115,14 @@ static void set_search_dir(const char *);
 static void set_out_file(const char *);
 
 static void open_temps();
+static void write_temp_line(const STATLine &);
+static void close_temps();
 
 
 ////////////////////////////////////////////////////////////////////////
 
 int met_main(int argc, char * argv []) {
    int i;
-   StringArray jobs_sa;
    ConcatString default_config_file;
 
    //
@@ -177,6 +184,17 @@ int met_main(int argc, char * argv []) {
            << "New default jobstring: \""
            << default_job.get_jobstring() << "\"\n";
 
+      //
+      // Apply the GO Index or CBS Index filtering criteria.
+      //
+      if(!using_python) amend_ss_index_default_job();
+
+      //
+      // Set up all of the jobs before reading the input so that
+      // their filtering criteria can be applied in a single pass.
+      //
+      setup_jobs();
+
       //
       // Process the STAT files found in the search directories.
       //
@@ -191,38 +209,10 @@ int met_main(int argc, char * argv []) {
 #endif
 
       //
-      // If a job was specified on the command line, run it.
-      //
-      if(default_job.job_type != no_stat_job_type) {
-         process_job(command_line_job_options.c_str(), 1);
-      }
-      //
-      // Or process config file jobs.
-      //
-      else if(config_file.length() > 0) {
-         jobs_sa = conf.lookup_string_array(conf_key_jobs);
-
-         //
-         // At least one job in the config file.
-         //
-         if(jobs_sa.n() == 0) {
-            mlog << Error << "\nmain() -> "
-                 << "no jobs defined in \"" << config_file << "\"!\n\n";
-            throw(1);
-         }
-
-         for(i=0; i<jobs_sa.n_elements(); i++) {
-            process_job(jobs_sa[i].c_str(), i+1);
-         }
-      }
-      //
-      // At least one job must be defined.
+      // Run the jobs.
       //
-      else {
-         mlog << Error << "\nmain() -> "
-              << "at least one job must be specified on the command line "
-              << "with \"-job\" or in a configuration file with \"-config\"!\n\n";
-         throw(1);
+      for(i=0; i<(int) job_list.size(); i++) {
+         process_job(i);
       }
    }
    catch(int j) { // Catch errors
@@ -288,6 +278,7 @@ void parse_command_line(int &argc, char **argv) {
    cline.add(set_lookin_path, "-lookin", -1);
    cline.add(set_out_filename, "-out", 1);
    cline.add(set_tmp_dir, "-tmp_dir", 1);
+   cline.add(set_cache, "-cache", 0);
    cline.add(set_config_file, "-config", 1);
 
    //
@@ -467,41 +458,6 @@ void process_search_dirs() {
       throw(1);
    }
 
-   //
-   // Apply the GO Index or CBS Index filtering criteria.
-   //
-   if(default_job.job_type == stat_job_go_index ||
-      default_job.job_type == stat_job_cbs_index) {
-
-      MetConfig ss_index_conf;
-      STATAnalysisJob ss_index_job;
-
-      ConcatString config_file =
-         (default_job.job_type == stat_job_go_index ?
-          replace_path(go_index_config_file) :
-          replace_path(cbs_index_config_file));
-
-      mlog << Debug(1) << "Skill Score Index Config File: "
-           << config_file << "\n";
-
-      //
-      // Read the config files for the constants and the skill score index.
-      //
-      ss_index_conf.read(replace_path(config_const_filename).c_str());
-      ss_index_conf.read(config_file.c_str());
-
-      //
-      // Parse the Skill Score Index config file into the search job.
-      //
-      ss_index_job.set_job_type(default_job.job_type);
-      set_job_from_config(ss_index_conf, ss_index_job);
-
-      //
-      // Amend the default job with Skill Score Index filtering criteria.
-      //
-      default_job.parse_job_command(ss_index_job.get_jobstring().c_str());
-   }
-
    //
    // Open up the temp file for storing the intermediate STAT line data
    //
@@ -539,7 +495,7 @@ void process_search_dirs() {
    mlog << Debug(2) << "STAT Lines read     = " << n_read << "\n";
    mlog << Debug(2) << "STAT Lines retained = " << n_keep << "\n";
 
-   tmp_out.close();
+   close_temps();
 
    return;
 }
@@ -550,6 +506,16 @@ void process_stat_file(const char *filename, const STATAnalysisJob &job, int &n_
 
    STATLine line;
    LineDataFile f;
+   STATCache cache;
+   long long beg, end;
+
+   //
+   // Use the cache file, if it is up to date
+   //
+   if(use_stat_cache && cache.read(filename)) {
+      process_stat_cache(filename, cache, job, n_read, n_keep);
+      return;
+   }
 
    if(!(f.open(filename))) {
       mlog << Error << "\nprocess_stat_file() -> "
@@ -559,13 +525,20 @@ void process_stat_file(const char *filename, const STATAnalysisJob &job, int &n_
       throw(1);
    }
 
+   beg = (long long) f.in->tellg();
 
    while(f >> line) {
 
+      end = (long long) f.in->tellg();
+
       //
       // Continue if the line is not a valid STAT line.
       //
-      if(line.type() == no_stat_line_type) continue;
+      if(line.type() == no_stat_line_type) { beg = end; continue; }
+
+      if(use_stat_cache) cache.add(line, beg, end);
+
+      beg = end;
 
       if(!line.is_header()) n_read++;
 
@@ -576,12 +549,82 @@ void process_stat_file(const char *filename, const STATAnalysisJob &job, int &n_
 
          if(!line.is_header()) n_keep++;
 
-         tmp_out << line;
+         write_temp_line(line);
       }
    } // end while
 
    f.close();
 
+   if(use_stat_cache) cache.write();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Use the cache to skip groups of lines and individual lines which
+// cannot pass the job filtering criteria, and only read and parse the
+// remaining lines of the STAT file.
+//
+////////////////////////////////////////////////////////////////////////
+
+void process_stat_cache(const char *filename, STATCache &cache,
+                        const STATAnalysisJob &job, int &n_read, int &n_keep) {
+
+   STATLine line;
+   LineDataFile f;
+   int i, j, n_parse;
+   bool keep_group;
+
+   if(!(f.open(filename))) {
+      mlog << Error << "\nprocess_stat_cache() -> "
+           << "unable to open input stat file \""
+           << filename << "\"\n\n";
+
+      throw(1);
+   }
+
+   cache.set_filter(job);
+
+   n_read += cache.n_data_rows();
+
+   for(i=0, n_parse=0; i<cache.n_groups(); i++) {
+
+      keep_group = cache.keep_group(i);
+
+      for(j=cache.group_beg(i); j<cache.group_end(i); j++) {
+
+         //
+         // Pass header lines through to the output
+         //
+         if(!cache.is_header(j) &&
+            (!keep_group || !cache.keep_row(j))) continue;
+
+         if(!cache.read_row(f, j, line)) {
+            mlog << Error << "\nprocess_stat_cache() -> "
+                 << "unable to read line " << j+1 << " of the cache for "
+                 << "input stat file \"" << filename << "\"\n\n";
+
+            throw(1);
+         }
+
+         n_parse++;
+
+         if(line.is_header() || job.is_keeper(line)) {
+
+            if(!line.is_header()) n_keep++;
+
+            write_temp_line(line);
+         }
+      }
+   }
+
+   mlog << Debug(4) << "Parsed " << n_parse << " of " << cache.n_rows()
+        << " lines of input stat file \"" << filename
+        << "\" using its cache file.\n";
+
+   f.close();
+
    return;
 }
 
@@ -628,7 +671,7 @@ while((*f) >> line) {
 
    if(line.is_header() || job.is_keeper(line)) {
 
-      tmp_out << line;
+      write_temp_line(line);
    }
 
 }   // while
@@ -639,6 +682,8 @@ while((*f) >> line) {
 
 f->close();
 
+close_temps();
+
 if(pldf) { delete pldf; pldf = (PyLineDataFile *) 0; }
 
 return;
@@ -649,11 +694,97 @@ return;
 
 ////////////////////////////////////////////////////////////////////////
 
-void process_job(const char * jobstring, int n_job) {
+void amend_ss_index_default_job() {
+
+   if(default_job.job_type != stat_job_go_index &&
+      default_job.job_type != stat_job_cbs_index) return;
+
+   MetConfig ss_index_conf;
+   STATAnalysisJob ss_index_job;
+
+   ConcatString config_file =
+      (default_job.job_type == stat_job_go_index ?
+       replace_path(go_index_config_file) :
+       replace_path(cbs_index_config_file));
+
+   mlog << Debug(1) << "Skill Score Index Config File: "
+        << config_file << "\n";
+
+   //
+   // Read the config files for the constants and the skill score index.
+   //
+   ss_index_conf.read(replace_path(config_const_filename).c_str());
+   ss_index_conf.read(config_file.c_str());
+
+   //
+   // Parse the Skill Score Index config file into the search job.
+   //
+   ss_index_job.set_job_type(default_job.job_type);
+   set_job_from_config(ss_index_conf, ss_index_job);
+
+   //
+   // Amend the default job with Skill Score Index filtering criteria.
+   //
+   default_job.parse_job_command(ss_index_job.get_jobstring().c_str());
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void setup_jobs() {
+   StringArray jobs_sa;
    STATAnalysisJob job;
-   ConcatString full_jobstring;
+   int i;
 
-   mlog << Debug(4) << "process_job(jobstring): "
+   job_list.clear();
+   job_string.clear();
+
+   //
+   // If a job was specified on the command line, run it.
+   //
+   if(default_job.job_type != no_stat_job_type) {
+      jobs_sa.add(command_line_job_options);
+   }
+   //
+   // Or process config file jobs.
+   //
+   else if(config_file.length() > 0) {
+      jobs_sa = conf.lookup_string_array(conf_key_jobs);
+
+      //
+      // At least one job in the config file.
+      //
+      if(jobs_sa.n() == 0) {
+         mlog << Error << "\nsetup_jobs() -> "
+              << "no jobs defined in \"" << config_file << "\"!\n\n";
+         throw(1);
+      }
+   }
+   //
+   // At least one job must be defined.
+   //
+   else {
+      mlog << Error << "\nsetup_jobs() -> "
+           << "at least one job must be specified on the command line "
+           << "with \"-job\" or in a configuration file with \"-config\"!\n\n";
+      throw(1);
+   }
+
+   for(i=0; i<jobs_sa.n(); i++) {
+      setup_job(jobs_sa[i].c_str(), i+1, job);
+      job_list.push_back(job);
+      job_string.add(job.get_jobstring());
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void setup_job(const char * jobstring, int n_job, STATAnalysisJob &job) {
+
+   mlog << Debug(4) << "setup_job(jobstring): "
         << jobstring << "\n";
 
    //
@@ -717,15 +848,67 @@ void process_job(const char * jobstring, int n_job) {
         << command_line_job_options << "\"\n";
    job.parse_job_command(command_line_job_options.c_str());
 
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Jobs whose filtering criteria do not change while they run can be
+// fed only the lines they keep during the initial pass through the
+// input data.  Other jobs read the shared temporary file.
+//
+////////////////////////////////////////////////////////////////////////
+
+bool is_prefilter_job(const STATAnalysisJob &job) {
+   bool status = false;
+
+   switch(job.job_type) {
+
+      case(stat_job_filter):
+      case(stat_job_summary):
+      case(stat_job_aggr):
+         status = true;
+         break;
+
+      case(stat_job_aggr_stat):
+
+         //
+         // The MPR wind aggregation resets the -fcst_var filter
+         //
+         status = !(job.line_type.has("MPR") &&
+                    (job.out_line_type.has("WDIR")  ||
+                     job.out_line_type.has("VL1L2") ||
+                     job.out_line_type.has("VCNT")));
+         break;
+
+      default:
+         status = false;
+         break;
+   }
+
+   return(status);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void process_job(int i_job) {
+
    //
-   // Get the full jobstring
+   // Read the per-job temp file, if available, which only contains
+   // the lines that the job keeps
    //
-   full_jobstring = job.get_jobstring();
+   ConcatString path = tmp_path;
+   int n_scan = bad_data_int;
+   if(!job_tmp_path[i_job].empty()) {
+      path   = job_tmp_path[i_job];
+      n_scan = n_temp_lines;
+   }
 
    //
    // Do the job
    //
-   do_job(full_jobstring, job, n_job, tmp_dir, tmp_path, sa_out);
+   do_job(job_string[i_job], job_list[i_job], i_job+1,
+          path, n_scan, sa_out);
 
    return;
 }
@@ -734,11 +917,17 @@ void process_job(const char * jobstring, int n_job) {
 
 void clean_up() {
 
+   int i;
+
    //
-   // Delete the temp file if it exists
+   // Delete the temp files if they exist
    //
    if(tmp_path.nonempty()) remove_temp_file(tmp_path);
 
+   for(i=0; i<job_tmp_path.n(); i++) {
+      if(!job_tmp_path[i].empty()) remove_temp_file(job_tmp_path[i]);
+   }
+
    return;
 }
 
@@ -753,6 +942,7 @@ void usage() {
         << "\t-lookin path\n"
         << "\t[-out file]\n"
         << "\t[-tmp_dir path]\n"
+        << "\t[-cache]\n"
         << "\t[-log file]\n"
         << "\t[-v level]\n"
         << "\t[-config config_file] | [JOB COMMAND LINE]\n\n"
@@ -768,6 +958,10 @@ void usage() {
         << "\t\t\"-tmp_dir path\" specifies the directory into which "
         << "temporary files should be written (optional).\n"
 
+        << "\t\t\"-cache\" reads and writes binary cache files "
+        << "alongside the input STAT files to speed up filtering "
+        << "(optional).\n"
+
         << "\t\t\"-log file\" outputs log messages to the specified "
         << "file (optional).\n"
 
@@ -852,6 +1046,12 @@ void set_tmp_dir(const StringArray & a) {
 
 ////////////////////////////////////////////////////////////////////////
 
+void set_cache(const StringArray &) {
+   use_stat_cache = true;
+}
+
+////////////////////////////////////////////////////////////////////////
+
 void set_config_file(const StringArray & a) {
    set_config(a[0].c_str());
 }
@@ -863,6 +1063,9 @@ void open_temps()
 
 {
 
+   int i, n_job_tmp;
+   ConcatString prefix;
+
    //
    // If the tmp_dir has not already been set on the command line,
    // use the config file setting or default setting.
@@ -872,6 +1075,45 @@ void open_temps()
       else                          tmp_dir = default_tmp_dir;
    }
 
+   //
+   // Open a temp file for each job whose filtering criteria can be
+   // applied while reading the input data
+   //
+   job_tmp_path.clear();
+   job_tmp_out.clear();
+   use_shared_tmp = false;
+
+   for(i=0, n_job_tmp=0; i<(int) job_list.size(); i++) {
+
+      if(n_job_tmp >= max_job_tmp_files ||
+         !is_prefilter_job(job_list[i])) {
+         job_tmp_path.add("");
+         job_tmp_out.push_back((ofstream *) 0);
+         use_shared_tmp = true;
+         continue;
+      }
+
+      prefix << cs_erase << tmp_dir << "/" << "tmp_stat_analysis_job_" << i+1;
+      job_tmp_path.add(make_temp_file_name(prefix.c_str(), nullptr));
+
+      job_tmp_out.push_back(new ofstream);
+      job_tmp_out[i]->open(job_tmp_path[i].c_str());
+      if(!(*job_tmp_out[i])) {
+         mlog << Error << "\nopen_temps() -> "
+              << "can't open the temporary file \"" << job_tmp_path[i]
+              << "\" for writing!\n\n";
+
+         throw(1);
+      }
+
+      n_job_tmp++;
+   }
+
+   mlog << Debug(3) << "Writing filtered STAT lines to " << n_job_tmp
+        << " job-specific temporary file(s).\n";
+
+   if(!use_shared_tmp) return;
+
    //
    // Build the temp file name
    //
@@ -896,4 +1138,61 @@ return;
 }
 
 
+////////////////////////////////////////////////////////////////////////
+//
+// Write a line retained by the default job to the shared temp file
+// and to the temp file of each job that keeps it.
+//
+////////////////////////////////////////////////////////////////////////
+
+
+void write_temp_line(const STATLine &line)
+
+{
+
+   int i;
+
+   if(!line.is_header()) n_temp_lines++;
+
+   if(use_shared_tmp) tmp_out << line;
+
+   for(i=0; i<(int) job_tmp_out.size(); i++) {
+
+      if(!job_tmp_out[i]) continue;
+
+      if(line.is_header() || job_list[i].is_keeper(line)) {
+         *job_tmp_out[i] << line;
+      }
+   }
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+void close_temps()
+
+{
+
+   int i;
+
+   if(tmp_out.is_open()) tmp_out.close();
+
+   for(i=0; i<(int) job_tmp_out.size(); i++) {
+
+      if(!job_tmp_out[i]) continue;
+
+      job_tmp_out[i]->close();
+      delete job_tmp_out[i];
+      job_tmp_out[i] = (ofstream *) 0;
+   }
+
+return;
+
+}
+
+
 ////////////////////////////////////////////////////////////////////////
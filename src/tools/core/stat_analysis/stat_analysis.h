@@ -34,6 +34,7 @@
 #include <string.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <vector>
 
 #include "vx_config.h"
 #include "vx_analysis_util.h"
@@ -58,6 +59,9 @@ static const char * go_index_config_file =
 static const char * cbs_index_config_file =
    "MET_BASE/config/STATAnalysisConfig_CBS_Index";
 
+// Maximum number of jobs that write their own filtered temp file
+static const int max_job_tmp_files = 256;
+
 ////////////////////////////////////////////////////////////////////////
 //
 // Variables for Command Line Arguments
@@ -92,6 +96,24 @@ static ConcatString tmp_path;
 // Output file stream for the temporary file
 static std::ofstream tmp_out;
 
+// Flag to indicate whether any job reads the shared temporary file
+static bool use_shared_tmp = true;
+
+// Jobs to be run, set up before the input STAT data is read
+static std::vector<STATAnalysisJob> job_list;
+static StringArray job_string;
+
+// Per-job temporary files containing only the lines each job keeps
+static StringArray job_tmp_path;
+static std::vector<std::ofstream *> job_tmp_out;
+
+// Number of STAT lines retained by the default job, which are the
+// lines scanned by the jobs filtered while reading the input
+static int n_temp_lines = 0;
+
+// Flag to indicate whether binary cache files should be used
+static bool use_stat_cache = false;
+
 // STAT-Analysis configuration object
 static MetConfig conf;
 
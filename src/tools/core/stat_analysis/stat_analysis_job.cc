@@ -154,8 +154,8 @@ void set_job_from_config(MetConfig &c, STATAnalysisJob &job) {
 ////////////////////////////////////////////////////////////////////////
 
 void do_job(const ConcatString &jobstring, STATAnalysisJob &job,
-            int n_job, const ConcatString &tmp_dir,
-            const ConcatString &tmp_path, ofstream *sa_out) {
+            int n_job, const ConcatString &tmp_path,
+            int n_scan, ofstream *sa_out) {
    LineDataFile f;
    int n_in, n_out;
    gsl_rng *rng_ptr = (gsl_rng *) 0;
@@ -239,7 +239,7 @@ void do_job(const ConcatString &jobstring, STATAnalysisJob &job,
          break;
 
       case(stat_job_aggr_stat):
-         do_job_aggr_stat(jobstring, f, job, n_in, n_out, sa_out, tmp_dir, rng_ptr);
+         do_job_aggr_stat(jobstring, f, job, n_in, n_out, sa_out, rng_ptr);
          break;
 
       case(stat_job_go_index):
@@ -258,6 +258,12 @@ void do_job(const ConcatString &jobstring, STATAnalysisJob &job,
          throw(1);
    }
 
+   //
+   // When the input was already filtered for this job, report the
+   // number of lines scanned rather than the number read back
+   //
+   if(!is_bad_data(n_scan)) n_in = n_scan;
+
    mlog << Debug(2) << "Job " << n_job << " used " << n_out << " out of "
         << n_in << " STAT lines.\n";
 
@@ -612,8 +618,7 @@ void do_job_aggr(const ConcatString &jobstring, LineDataFile &f,
 
 void do_job_aggr_stat(const ConcatString &jobstring, LineDataFile &f,
                       STATAnalysisJob &job, int &n_in, int &n_out,
-                      ofstream *sa_out, const ConcatString &tmp_dir,
-                      gsl_rng *rng_ptr) {
+                      ofstream *sa_out, gsl_rng *rng_ptr) {
    STATLine line;
    STATLineType in_lt;
    vector<STATLineType> out_lt;
@@ -1010,7 +1015,7 @@ void do_job_aggr_stat(const ConcatString &jobstring, LineDataFile &f,
       // Write the output
       //
       for(it=out_lt.begin(); it!=out_lt.end(); it++) {
-         write_job_aggr_mpr(job, *it, mpr_map, out_at, tmp_dir.c_str(), rng_ptr);
+         write_job_aggr_mpr(job, *it, mpr_map, out_at, rng_ptr);
          if(!job.stat_out) write_table(out_at, sa_out);
       }
    }
@@ -3141,8 +3146,7 @@ void write_job_aggr_isc(STATAnalysisJob &job, STATLineType lt,
 
 void write_job_aggr_mpr(STATAnalysisJob &job, STATLineType lt,
                         map<ConcatString, AggrMPRInfo> &m,
-                        AsciiTable &at, const char *tmp_dir,
-                        gsl_rng *rng_ptr) {
+                        AsciiTable &at, gsl_rng *rng_ptr) {
    map<ConcatString, AggrMPRInfo>::iterator it;
    int n, n_row, n_col, r, c, i;
    StatHdrColumns shc;
@@ -3282,7 +3286,7 @@ void write_job_aggr_mpr(STATAnalysisJob &job, STATLineType lt,
       //
       else if(lt == stat_cts) {
          for(i=0; i<job.out_fcst_thresh.n(); i++) {
-            mpr_to_cts(job, it->second, i, cts_info, tmp_dir, rng_ptr);
+            mpr_to_cts(job, it->second, i, cts_info, rng_ptr);
             if(job.stat_out) {
                shc.set_fcst_thresh(job.out_fcst_thresh[i]);
                shc.set_obs_thresh(job.out_obs_thresh[i]);
@@ -3343,7 +3347,7 @@ void write_job_aggr_mpr(STATAnalysisJob &job, STATLineType lt,
       // MCTS output line
       //
       else if(lt == stat_mcts) {
-         mpr_to_mcts(job, it->second, mcts_info, tmp_dir, rng_ptr);
+         mpr_to_mcts(job, it->second, mcts_info, rng_ptr);
          if(job.stat_out) {
             shc.set_fcst_thresh(job.out_fcst_thresh);
             shc.set_obs_thresh(job.out_obs_thresh);
@@ -3364,7 +3368,7 @@ void write_job_aggr_mpr(STATAnalysisJob &job, STATLineType lt,
       //
       else if(lt == stat_cnt) {
          for(i=0; i<job.out_fcst_thresh.n(); i++) {
-            mpr_to_cnt(job, it->second, i, cnt_info, tmp_dir, rng_ptr);
+            mpr_to_cnt(job, it->second, i, cnt_info, rng_ptr);
             if(cnt_info.n == 0) continue;
             if(job.stat_out) {
                shc.set_fcst_thresh(job.out_fcst_thresh[i]);
@@ -51,8 +51,7 @@
 extern void set_job_from_config(MetConfig &, STATAnalysisJob &);
 
 extern void do_job(const ConcatString &, STATAnalysisJob &, int,
-               const ConcatString &, const ConcatString &,
-               std::ofstream *);
+               const ConcatString &, int, std::ofstream *);
 
 extern void do_job_filter(const ConcatString &, LineDataFile &,
                STATAnalysisJob &, int &, int &, std::ofstream *);
@@ -65,7 +64,7 @@ extern void do_job_aggr(const ConcatString &, LineDataFile &,
 
 extern void do_job_aggr_stat(const ConcatString &, LineDataFile &,
                STATAnalysisJob &, int &, int &, std::ofstream *,
-               const ConcatString &, gsl_rng *);
+               gsl_rng *);
 
 extern void do_job_ss_index(const ConcatString &, LineDataFile &,
                STATAnalysisJob &, int &, int &, std::ofstream *);
@@ -133,7 +132,7 @@ extern void write_job_aggr_isc(STATAnalysisJob &, STATLineType,
 
 extern void write_job_aggr_mpr(STATAnalysisJob &, STATLineType,
                std::map<ConcatString, AggrMPRInfo> &, AsciiTable &,
-               const char *, gsl_rng *);
+               gsl_rng *);
 
 extern void write_job_aggr_mpr_wind(STATAnalysisJob &, STATLineType,
                std::map<ConcatString, AggrWindInfo> &, AsciiTable &);
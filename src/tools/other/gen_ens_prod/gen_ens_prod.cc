@@ -629,7 +629,7 @@ bool get_data_plane(const char *infile, GrdFileType ftype,
    Met2dDataFile *mtddf = (Met2dDataFile *) 0;
 
    // Read the current ensemble file
-   if(!(mtddf = mtddf_factory.new_met_2d_data_file(infile, ftype))) {
+   if(!(mtddf = mtddf_cache.get(infile, ftype))) {
       mlog << Error << "\nget_data_plane() -> "
            << "trouble reading file \"" << infile << "\"\n\n";
       exit(1);
@@ -667,8 +667,8 @@ bool get_data_plane(const char *infile, GrdFileType ftype,
 
    } // end if found
 
-   // Deallocate the data file pointer, if necessary
-   if(mtddf) { delete mtddf; mtddf = (Met2dDataFile *) 0; }
+   // Release the data file pointer
+   mtddf_cache.release(mtddf);
 
    return(found);
 }
@@ -701,20 +701,18 @@ void clear_counts() {
 
 void track_counts(GenEnsProdVarInfo *ens_info, const DataPlane &ens_dp, bool is_ctrl,
                   const DataPlane &cmn_dp, const DataPlane &csd_dp) {
-   int i, j, k;
-   double ens, cmn, csd;
+   int i, j, k, n_vld;
+   double ens;
 
    // Ensemble thresholds
    const int n_thr = ens_info->cat_ta.n();
    SingleThresh *thr_buf = ens_info->cat_ta.buf();
 
    // Increment counts for each grid point
-   for(i=0; i<nxy; i++) {
+   for(i=0, n_vld=0; i<nxy; i++) {
 
       // Get current values
       ens = ens_dp.data()[i];
-      cmn = (cmn_dp.is_empty() ? bad_data_double : cmn_dp.data()[i]);
-      csd = (csd_dp.is_empty() ? bad_data_double : csd_dp.data()[i]);
 
       // Skip bad data values
       if(is_bad_data(ens)) continue;
@@ -739,28 +737,74 @@ void track_counts(GenEnsProdVarInfo *ens_info, const DataPlane &ens_dp, bool is_
             stdev_cnt_na.buf()[i] += 1;
          }
 
-         // Event frequency
-         for(j=0; j<n_thr; j++) {
-            if(thr_buf[j].check(ens, cmn, csd)) thresh_cnt_na[j].inc(i, 1);
-         }
+         // Valid data count for the event frequency
+         n_vld++;
       } // end else
    } // end for i
 
+   // Event frequency, applying each threshold to all valid data at once
+   if(n_thr > 0 && n_vld > 0) {
+      const double *ens_ptr = ens_dp.data();
+      const double *cmn_ptr = (cmn_dp.is_empty() ? nullptr : cmn_dp.data());
+      const double *csd_ptr = (csd_dp.is_empty() ? nullptr : csd_dp.data());
+      vector<int>    vld_i;
+      vector<double> vld_ens, vld_cmn, vld_csd;
+
+      // Only copy the valid data when some of it is bad data
+      if(n_vld < nxy) {
+         vld_i.reserve(n_vld);
+         vld_ens.reserve(n_vld);
+         if(cmn_ptr) vld_cmn.reserve(n_vld);
+         if(csd_ptr) vld_csd.reserve(n_vld);
+         for(i=0; i<nxy; i++) {
+            if(is_bad_data(ens_ptr[i])) continue;
+            vld_i.push_back(i);
+            vld_ens.push_back(ens_ptr[i]);
+            if(cmn_ptr) vld_cmn.push_back(cmn_ptr[i]);
+            if(csd_ptr) vld_csd.push_back(csd_ptr[i]);
+         }
+         ens_ptr = vld_ens.data();
+         if(cmn_ptr) cmn_ptr = vld_cmn.data();
+         if(csd_ptr) csd_ptr = vld_csd.data();
+      }
+
+      bool *tf = new bool [n_vld];
+
+      for(j=0; j<n_thr; j++) {
+         thr_buf[j].check(ens_ptr, cmn_ptr, csd_ptr, n_vld, tf);
+         if(vld_i.empty()) {
+            for(k=0; k<n_vld; k++) {
+               if(tf[k]) thresh_cnt_na[j].inc(k, 1);
+            }
+         }
+         else {
+            for(k=0; k<n_vld; k++) {
+               if(tf[k]) thresh_cnt_na[j].inc(vld_i[k], 1);
+            }
+         }
+      }
+
+      if(tf) { delete [] tf; tf = (bool *) 0; }
+   }
+
    // Increment NMEP count anywhere fractional coverage > 0
    if(ens_info->nc_info.do_nmep) {
       DataPlane frac_dp;
+      CoverageCounts cc;
 
       // Loop over thresholds
       for(i=0; i<n_thr; i++) {
 
+         // Apply the current threshold
+         cc.set(ens_dp, thr_buf[i], &cmn_dp, &csd_dp);
+
          // Loop over neighborhood sizes
          for(j=0; j<conf_info.get_n_nbrhd(); j++) {
 
             // Compute fractional coverage
-            fractional_coverage(ens_dp, frac_dp,
+            cc.fractional_coverage(frac_dp,
                conf_info.nbrhd_prob.width[j],
                conf_info.nbrhd_prob.shape, grid.wrap_lon(),
-               thr_buf[i], &cmn_dp, &csd_dp,
                conf_info.nbrhd_prob.vld_thresh);
 
             // Increment counts
@@ -1248,6 +1292,9 @@ void clean_up() {
       thresh_nbrhd_cnt_na = (NumArray **) 0;
    }
 
+   // Close any cached data files
+   mtddf_cache.clear();
+
    return;
 }
 
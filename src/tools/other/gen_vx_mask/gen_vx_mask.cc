@@ -858,7 +858,7 @@ void apply_box_mask(DataPlane &dp) {
 ////////////////////////////////////////////////////////////////////////
 
 void apply_circle_mask(DataPlane &dp) {
-   int x, y, i, n_in;
+   int x, y, i, j, k, n_in;
    double lat, lon, dist, v;
    bool check;
 
@@ -870,6 +870,18 @@ void apply_circle_mask(DataPlane &dp) {
            << "the minimum distance to the points will be written.\n\n";
    }
 
+   // Sort the polyline points by latitude
+   const int n_pts = poly_mask.n_points();
+   vector<int> pt_order(n_pts);
+   vector<double> pt_lat(n_pts), pt_lon(n_pts);
+   for(i=0; i<n_pts; i++) pt_order[i] = i;
+   sort(pt_order.begin(), pt_order.end(),
+        [](int a, int b) { return(poly_mask.lat(a) < poly_mask.lat(b)); });
+   for(i=0; i<n_pts; i++) {
+      pt_lat[i] = poly_mask.lat(pt_order[i]);
+      pt_lon[i] = poly_mask.lon(pt_order[i]);
+   }
+
    // For each grid point, compute mimumum distance to polyline points
    for(x=0,n_in=0; x<grid.nx(); x++) {
       for(y=0; y<grid.ny(); y++) {
@@ -878,9 +890,23 @@ void apply_circle_mask(DataPlane &dp) {
          grid.xy_to_latlon(x, y, lat, lon);
          lon -= 360.0*floor((lon + 180.0)/360.0);
 
-         // Find the minimum distance to a polyline point
-         for(i=0, dist=1.0E10; i<poly_mask.n_points(); i++) {
-            dist = min(dist, gc_dist(lat, lon, poly_mask.lat(i), poly_mask.lon(i)));
+         // Find the minimum distance to a polyline point, searching
+         // outward in latitude and stopping once the latitude
+         // difference alone exceeds the closest distance found
+         dist = 1.0E10;
+         j = lower_bound(pt_lat.begin(), pt_lat.end(), lat) - pt_lat.begin();
+         k = j - 1;
+         while(j < n_pts || k >= 0) {
+            if(k < 0 || (j < n_pts && pt_lat[j] - lat < lat - pt_lat[k])) {
+               if(circle_dist_bound(pt_lat[j] - lat) > dist) break;
+               dist = min(dist, gc_dist(lat, lon, pt_lat[j], pt_lon[j]));
+               j++;
+            }
+            else {
+               if(circle_dist_bound(lat - pt_lat[k]) > dist) break;
+               dist = min(dist, gc_dist(lat, lon, pt_lat[k], pt_lon[k]));
+               k--;
+            }
          }
 
          // Apply threshold, if specified
@@ -928,6 +954,18 @@ void apply_circle_mask(DataPlane &dp) {
    return;
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// Lower bound on the great circle distance between two points whose
+// latitudes differ by dlat degrees, shrunk slightly to allow for
+// rounding in gc_dist().
+//
+////////////////////////////////////////////////////////////////////////
+
+double circle_dist_bound(double dlat) {
+   return(earth_radius_km*dlat*rad_per_deg*(1.0 - 1.0E-10));
+}
+
 ////////////////////////////////////////////////////////////////////////
 
 void apply_track_mask(DataPlane &dp) {
@@ -1268,20 +1306,23 @@ void apply_shape_mask(DataPlane & dp) {
       poly_list.push_back(poly);
    }
 
+   // Flag the grid points inside each shape, only checking the
+   // points inside its bounding box
+   MaskPlane inside;
+   inside.set_size(grid.nx(), grid.ny(), false);
+
+   vector<GridClosedPolyArray>::const_iterator poly_it;
+   for(poly_it  = poly_list.begin();
+       poly_it != poly_list.end(); ++poly_it) {
+      poly_it->set_mask_inside(inside);
+   }
+
    // Check grid points
    for(x=0,n_in=0; x<(grid.nx()); x++) {
       for(y=0; y<(grid.ny()); y++) {
 
-         vector<GridClosedPolyArray>::const_iterator poly_it;
-         for(poly_it  = poly_list.begin();
-             poly_it != poly_list.end(); ++poly_it) {
-
-            // Check if point is inside
-            status = poly_it->is_inside(x, y);
-
-            // Break after the first match
-            if(status) break;
-         }
+         // Check if point is inside any shape
+         status = inside(x, y);
 
          // Check the complement
          if(complement) status = !status;
@@ -139,6 +139,7 @@ static void      apply_poly_xy_mask(DataPlane &dp);
 static void      apply_shape_mask(DataPlane &dp);
 static void      apply_box_mask(DataPlane &dp);
 static void      apply_circle_mask(DataPlane &dp);
+static double    circle_dist_bound(double dlat);
 static void      apply_track_mask(DataPlane &dp);
 static void      apply_grid_mask(DataPlane &dp);
 static void      apply_data_mask(DataPlane &dp);
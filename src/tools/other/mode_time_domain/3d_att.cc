@@ -1241,164 +1241,227 @@ SingleAtt3D calc_3d_single_atts(const Object & mask, const MtdFloatFile & raw, c
 
 {
 
-int j, t;
-int n, nt, Vol;
-SingleAtt3D a;
+vector<SingleAtt3D> a;
+
+calc_3d_single_atts(mask, raw, model, ptile_value, a);
+
+return ( a[0] );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//
+//  Computes the single attributes of every object in a labeled field
+//  in one pass over the field, instead of one pass over a copy of the
+//  field for each object.
+//
+////////////////////////////////////////////////////////////////////////
+
+
+void calc_3d_single_atts(const Object & objects, const MtdFloatFile & raw, const char * model, const int ptile_value, vector<SingleAtt3D> & atts)
+
+{
+
+int j, k, t, x, y, n;
+int nt;
 double bbox_volume;
 double lat, lon;
 double xbar_2d, ybar_2d, x_old, y_old;
 double dist;
-ConcatString raw_filename;
-float * values = (float *) 0;
-const int   * i = 0;
-const float * r = 0;
-Mtd_3D_Moments moments;
-const int n3 = (mask.nx())*(mask.ny())*(mask.nt());
-const Grid * grid = mask.grid_p();
+const int Nx = objects.nx();
+const int Ny = objects.ny();
+const int Nt = objects.nt();
+const int n_obj = objects.n_objects();
+const int   * i = objects.data();
+const float * r = raw.data();
+const Grid * grid = objects.grid_p();
 
+vector<Mtd_3D_Moments> moments(n_obj);
+vector<vector<float>>  values(n_obj);
+vector<int>            x_min(n_obj, 2*Nx), x_max(n_obj, -1);
+vector<int>            y_min(n_obj, 2*Ny), y_max(n_obj, -1);
+vector<int>            t_min(n_obj, 2*Nt), t_max(n_obj, -1);
 
-moments = mask.calc_3d_moments();
+   //
+   //  2D centroid sums for each object at each time
+   //
 
-if ( moments.N == 0 )  {
+vector<double> x_2d(n_obj*Nt, 0.0), y_2d(n_obj*Nt, 0.0);
+vector<int>    n_2d(n_obj*Nt, 0);
 
-   mlog << Error << "\n\ncalc_3d_single_atts() -> "
-        << "empty object!\n\n";
+   //
+   //  accumulate everything in one pass
+   //
 
-   exit ( 1 );
+n = 0;
 
-}
+for (t=0; t<Nt; ++t)  {
+
+   for (y=0; y<Ny; ++y)  {
+
+      for (x=0; x<Nx; ++x, ++n)  {
 
-a.Xbar = (moments.Sx)/(moments.N);
-a.Ybar = (moments.Sy)/(moments.N);
-a.Tbar = (moments.St)/(moments.N);
+         k = i[n] - 1;
 
-moments.centralize();
+         if ( k < 0 )  continue;
 
+         if ( k >= n_obj )  {
 
-raw.xy_to_latlon(a.Xbar, a.Ybar, lat, lon);
+            mlog << Error << "\n\ncalc_3d_single_atts() -> "
+                 << "object number " << (k + 1) << " out of range\n\n";
 
-a.Centroid_Lat = lat;
-a.Centroid_Lon = lon;
+            exit ( 1 );
 
-a.Volume = mask.volume(0);
+         }
 
-mask.calc_3d_bbox(a.Xmin, a.Xmax, a.Ymin, a.Ymax, a.Tmin, a.Tmax);
+         moments[k].add(x, y, t);
 
-bbox_volume =  (a.Xmax - a.Xmin + 1.0)
-              *(a.Ymax - a.Ymin + 1.0)
-              *(a.Tmax - a.Tmin + 1.0);
+         if ( x < x_min[k] )  x_min[k] = x;
+         if ( y < y_min[k] )  y_min[k] = y;
+         if ( t < t_min[k] )  t_min[k] = t;
 
-a.Complexity = ((double) (a.Volume))/bbox_volume;
+         if ( x > x_max[k] )  x_max[k] = x;
+         if ( y > y_max[k] )  y_max[k] = y;
+         if ( t > t_max[k] )  t_max[k] = t;
+
+         x_2d[k*Nt + t] += x;
+         y_2d[k*Nt + t] += y;
+         n_2d[k*Nt + t]++;
+
+         values[k].push_back(r[n]);
+
+      }   //  for x
+
+   }   //  for y
+
+}   //  for t
 
    //
-   //  velocity, orientation
+   //  attributes of each object
    //
 
-if ( a.n_times() <= 1 )  {
+atts.resize(n_obj);
 
-   a.Xvelocity = a.Yvelocity = 0.0;
+for (k=0; k<n_obj; ++k)  {
 
-   a.set_spatial_axis(0.0);
+   SingleAtt3D & a = atts[k];
 
-} else {
+   a = SingleAtt3D();
 
-   moments.calc_3d_velocity(a.Xvelocity, a.Yvelocity);
+   Mtd_3D_Moments & m = moments[k];
 
-   a.set_spatial_axis(moments.calc_3d_axis_plane_angle());
+   if ( m.N == 0 )  {
 
-}   //  else
+      mlog << Error << "\n\ncalc_3d_single_atts() -> "
+           << "empty object!\n\n";
 
+      exit ( 1 );
 
-   //
-   //  distance travelled by the 2D centroid
-   //
+   }
 
-dist = 0.0;
+   a.Xbar = (m.Sx)/(m.N);
+   a.Ybar = (m.Sy)/(m.N);
+   a.Tbar = (m.St)/(m.N);
 
-nt = a.Tmax - a.Tmin + 1;
+   m.centralize();
 
-for (j=0,x_old=0,y_old=0; j<nt; ++j)  {
+   raw.xy_to_latlon(a.Xbar, a.Ybar, lat, lon);
 
-   t = j + a.Tmin;
+   a.Centroid_Lat = lat;
+   a.Centroid_Lon = lon;
 
-   mask.calc_2d_centroid_at_t(t, xbar_2d, ybar_2d);
+   a.Volume = m.N;
 
-   //
-   //  distance from the old to current (x, y)
-   //
+   a.Xmin = x_min[k];  a.Xmax = x_max[k];
+   a.Ymin = y_min[k];  a.Ymax = y_max[k];
+   a.Tmin = t_min[k];  a.Tmax = t_max[k];
 
-   if ( j > 0 )  {
+   bbox_volume =  (a.Xmax - a.Xmin + 1.0)
+                 *(a.Ymax - a.Ymin + 1.0)
+                 *(a.Tmax - a.Tmin + 1.0);
 
-      dist += calc_2d_dist(xbar_2d, ybar_2d, x_old, y_old, *grid);
+   a.Complexity = ((double) (a.Volume))/bbox_volume;
 
-   }
+      //
+      //  velocity, orientation
+      //
 
-   //
-   //  update old (x, y) with current
-   //
+   if ( a.n_times() <= 1 )  {
 
-   x_old = xbar_2d;
-   y_old = ybar_2d;
+      a.Xvelocity = a.Yvelocity = 0.0;
 
-}
+      a.set_spatial_axis(0.0);
 
-a.set_cdist_travelled(dist);
+   } else {
 
-   //
-   //  percentiles
-   //
+      m.calc_3d_velocity(a.Xvelocity, a.Yvelocity);
 
-Vol = a.Volume;
+      a.set_spatial_axis(m.calc_3d_axis_plane_angle());
 
-values = new float [Vol];
+   }   //  else
 
-if ( !values )  {
+      //
+      //  distance travelled by the 2D centroid
+      //
 
-   mlog << Error << "\n\ncalc_3d_single_atts() -> "
-        << "memory allocation error\n\n";
+   dist = 0.0;
 
-   exit ( 1 );
+   nt = a.Tmax - a.Tmin + 1;
 
-}
+   for (j=0,x_old=0,y_old=0; j<nt; ++j)  {
 
-n = 0;
+      t = j + a.Tmin;
 
-i = mask.data();
-r = raw.data();
+      xbar_2d = ybar_2d = 0.0;
 
-for (j=0; j<n3; ++j)  {
+      if ( n_2d[k*Nt + t] > 0 )  {
+
+         xbar_2d = x_2d[k*Nt + t]/n_2d[k*Nt + t];
+         ybar_2d = y_2d[k*Nt + t]/n_2d[k*Nt + t];
 
-   if ( *i )  {
+      }
+
+      if ( j > 0 )  {
 
-      values[n++] = *r;
+         dist += calc_2d_dist(xbar_2d, ybar_2d, x_old, y_old, *grid);
+
+      }
+
+      x_old = xbar_2d;
+      y_old = ybar_2d;
 
    }
 
-   ++i; ++r;
+   a.set_cdist_travelled(dist);
 
-}
+      //
+      //  percentiles
+      //
+
+   vector<float> & v = values[k];
 
+   sort_f(v.data(), (int) v.size());
 
-sort_f(values, n);
+   a.Ptile_10 = percentile_f(v.data(), (int) v.size(), 0.10);
+   a.Ptile_25 = percentile_f(v.data(), (int) v.size(), 0.25);
+   a.Ptile_50 = percentile_f(v.data(), (int) v.size(), 0.50);
+   a.Ptile_75 = percentile_f(v.data(), (int) v.size(), 0.75);
+   a.Ptile_90 = percentile_f(v.data(), (int) v.size(), 0.90);
 
-a.Ptile_10 = percentile_f(values, n, 0.10);
-a.Ptile_25 = percentile_f(values, n, 0.25);
-a.Ptile_50 = percentile_f(values, n, 0.50);
-a.Ptile_75 = percentile_f(values, n, 0.75);
-a.Ptile_90 = percentile_f(values, n, 0.90);
+   a.Ptile_Value = ptile_value;
 
-a.Ptile_Value = ptile_value;
+   a.Ptile_User = percentile_f(v.data(), (int) v.size(), (double) (a.Ptile_Value/100.0));
 
-a.Ptile_User = percentile_f(values, n, (double) (a.Ptile_Value/100.0));
+   vector<float>().swap(v);
 
+}   //  for k
 
    //
    //   done
    //
 
-if ( values )  { delete [] values;  values = 0; }
-
-return ( a );
+return;
 
 }
 
@@ -1415,18 +1478,8 @@ PairAtt3D calc_3d_pair_atts(const Object      & fcst_obj,
 
 int x, y, t;
 int IV, UV;
-PairAtt3D p;
-double dx, dy;
-double x1dot, x2dot, y1dot, y2dot;
-double b, b1, b2;
-double num, den;
 bool obs_on  = false;
 bool fcst_on = false;
-const double tol = 1.0e-3;
-
-
-p.set_fcst_obj_number (fcst_att.object_number());
-p.set_obs_obj_number  (obs_att.object_number());
 
    //
    //  intersection and union volumes
@@ -1452,8 +1505,84 @@ for (x=0; x<(fcst_obj.nx()); ++x)  {
 
 }
 
+return ( calc_3d_pair_atts(IV, fcst_att, obs_att) );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+//
+//  Intersection volumes of every forecast object with every observation
+//  object, stored at (fcst_number - 1)*n_obs + (obs_number - 1), from a
+//  single pass over the two labeled fields.
+//
+////////////////////////////////////////////////////////////////////////
+
+
+void calc_3d_intersection_volumes(const Object & fcst_objs, const Object & obs_objs, vector<int> & IV)
+
+{
+
+int j, f, o;
+const int n_fcst = fcst_objs.n_objects();
+const int n_obs  =  obs_objs.n_objects();
+const int n3     = (fcst_objs.nx())*(fcst_objs.ny())*(fcst_objs.nt());
+const int * fi   = fcst_objs.data();
+const int * oi   =  obs_objs.data();
+
+if ( (obs_objs.nx() != fcst_objs.nx()) ||
+     (obs_objs.ny() != fcst_objs.ny()) ||
+     (obs_objs.nt() != fcst_objs.nt()) )  {
+
+   mlog << Error << "\n\ncalc_3d_intersection_volumes() -> "
+        << "forecast and observation fields have different dimensions\n\n";
+
+   exit ( 1 );
+
+}
+
+IV.assign(n_fcst*n_obs, 0);
+
+for (j=0; j<n3; ++j)  {
+
+   f = fi[j];
+   o = oi[j];
+
+   if ( (f > 0) && (o > 0) && (f <= n_fcst) && (o <= n_obs) )  {
+
+      ++IV[(f - 1)*n_obs + (o - 1)];
+
+   }
+
+}
+
+return;
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
+PairAtt3D calc_3d_pair_atts(const int           IV,
+                            const SingleAtt3D & fcst_att,
+                            const SingleAtt3D &  obs_att)
+
+{
+
+int t;
+PairAtt3D p;
+double dx, dy;
+double x1dot, x2dot, y1dot, y2dot;
+double b, b1, b2;
+double num, den;
+const double tol = 1.0e-3;
+
+
+p.set_fcst_obj_number (fcst_att.object_number());
+p.set_obs_obj_number  (obs_att.object_number());
+
 p.set_intersection_volume (IV);
-// p.set_union_volume        (UV);
 
    //
    //  centroid distances
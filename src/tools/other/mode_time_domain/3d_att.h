@@ -19,6 +19,7 @@
 
 
 #include <iostream>
+#include <vector>
 
 #include "vx_util.h"
 
@@ -39,6 +40,7 @@ typedef MtdFloatFile Raw;
 class SingleAtt3D {
 
       friend SingleAtt3D calc_3d_single_atts(const Object & mask, const Raw & raw, const char * model, int obj_number);
+      friend void        calc_3d_single_atts(const Object &, const Raw &, const char *, const int, std::vector<SingleAtt3D> &);
 
    public:
 
@@ -260,6 +262,10 @@ class PairAtt3D {
                                          const SingleAtt3D &  _fa, 
                                          const SingleAtt3D &  _oa);
 
+      friend PairAtt3D calc_3d_pair_atts(const int IV,
+                                         const SingleAtt3D &  _fa,
+                                         const SingleAtt3D &  _oa);
+
    public:
 
       void init_from_scratch();
@@ -425,11 +431,24 @@ inline void PairAtt3D::set_cluster () { IsSimple = false;  return; }
 
 extern SingleAtt3D calc_3d_single_atts(const Object & mask, const Raw & raw, const char * model, const int ptile_value);
 
+   //
+   //  attributes of all the objects in a labeled field, in one pass
+   //
+
+extern void        calc_3d_single_atts(const Object & objects, const Raw & raw, const char * model, const int ptile_value,
+                                       std::vector<SingleAtt3D> & atts);
+
 extern PairAtt3D   calc_3d_pair_atts(const Object      & _fcst_obj, 
                                      const Object      & _obs_obj, 
                                      const SingleAtt3D & _fa, 
                                      const SingleAtt3D & _oa);
 
+extern PairAtt3D   calc_3d_pair_atts(const int           IV,
+                                     const SingleAtt3D & _fa,
+                                     const SingleAtt3D & _oa);
+
+extern void        calc_3d_intersection_volumes(const Object & fcst_objs, const Object & obs_objs, std::vector<int> & IV);
+
 // extern double calc_total_interest(const PairAtt3D &, const MtdConfigInfo &);
 
 
@@ -340,16 +340,16 @@ if ( have_pairs )  engine.set_size(fcst_obj.n_objects(), obs_obj.n_objects());
 
 SingleAtt3D att_3;
 SingleAtt3DArray fcst_single_att, obs_single_att;
-Object mask;
+vector<SingleAtt3D> atts;
 
 mlog << Debug(2)
      << "Calculating 3D fcst single attributes\n";
 
-for (j=0; j<(fcst_obj.n_objects()); ++j)  {
+calc_3d_single_atts(fcst_obj, fcst_raw, config.model.c_str(), config.inten_perc_value, atts);
 
-   mask = fcst_obj.select(j + 1);   //  1-based
+for (j=0; j<(fcst_obj.n_objects()); ++j)  {
 
-   att_3 = calc_3d_single_atts(mask, fcst_raw, config.model.c_str(), config.inten_perc_value);
+   att_3 = atts[j];
 
    att_3.set_object_number(j + 1);   //  1-based
 
@@ -366,11 +366,11 @@ for (j=0; j<(fcst_obj.n_objects()); ++j)  {
 mlog << Debug(2)
      << "Calculating 3D obs single attributes\n";
 
-for (j=0; j<(obs_obj.n_objects()); ++j)  {
+calc_3d_single_atts(obs_obj, obs_raw, config.model.c_str(), config.inten_perc_value, atts);
 
-   mask = obs_obj.select(j + 1);   //  1-based
+for (j=0; j<(obs_obj.n_objects()); ++j)  {
 
-   att_3 = calc_3d_single_atts(mask, obs_raw, config.model.c_str(), config.inten_perc_value);
+   att_3 = atts[j];
 
    att_3.set_object_number(j + 1);   //  1-based
 
@@ -390,23 +390,21 @@ for (j=0; j<(obs_obj.n_objects()); ++j)  {
 
 PairAtt3DArray pa_simple;
 PairAtt3D p;
-MtdIntFile fo, oo;
+vector<int> IV;
 
 if ( have_pairs )  {
 
+   calc_3d_intersection_volumes(fcst_obj, obs_obj, IV);
+
    // mlog << Debug(5) << "\n  Calculating pair attributes ... (Nf = "
    //      << (fcst_obj.n_objects()) << ", No = "
    //      << (obs_obj.n_objects())  << ")\n\n";
 
    for (j=0; j<(fcst_obj.n_objects()); ++j)  {
 
-      fo = fcst_obj.select(j + 1);
-
       for (k=0; k<(obs_obj.n_objects()); ++k)  {
 
-         oo = obs_obj.select(k + 1);
-
-         p = calc_3d_pair_atts(fo, oo, fcst_single_att[j], obs_single_att[k]);
+         p = calc_3d_pair_atts(IV[j*(obs_obj.n_objects()) + k], fcst_single_att[j], obs_single_att[k]);
 
          p.set_total_interest(engine.calc(p));
 
@@ -581,21 +579,33 @@ if ( have_pairs )  {
    //
 
 SingleAtt3DArray fcst_cluster_att, obs_cluster_att;
+MtdIntFile fcst_clus, obs_clus;   //  objects relabeled by cluster number
 
 if ( have_pairs )  {
 
-   mlog << Debug(2)
-        << "Calculating 3D fcst cluster attributes\n";
+   vector<IntArray> fcst_comp(n_clusters), obs_comp(n_clusters);
 
    for (j=0; j<n_clusters; ++j)  {
 
-      a = engine.fcst_composite(j);   //  0-based
+      fcst_comp[j] = engine.fcst_composite(j);   //  0-based
+       obs_comp[j] = engine.obs_composite(j);    //  0-based
 
-      a.increment(1);
+      fcst_comp[j].increment(1);
+       obs_comp[j].increment(1);
 
-      mask = fcst_obj.select_cluster(a);   //  1-based
+   }
+
+   fcst_clus = fcst_obj.select_clusters(fcst_comp);   //  1-based
+    obs_clus =  obs_obj.select_clusters(obs_comp);    //  1-based
+
+   mlog << Debug(2)
+        << "Calculating 3D fcst cluster attributes\n";
 
-      att_3 = calc_3d_single_atts(mask, fcst_raw, config.model.c_str(), config.inten_perc_value);
+   calc_3d_single_atts(fcst_clus, fcst_raw, config.model.c_str(), config.inten_perc_value, atts);
+
+   for (j=0; j<n_clusters; ++j)  {
+
+      att_3 = atts[j];
 
       att_3.set_object_number(j + 1);   //  1-based
 
@@ -612,15 +622,11 @@ if ( have_pairs )  {
    mlog << Debug(2)
         << "Calculating 3D obs cluster attributes\n";
 
-   for (j=0; j<n_clusters; ++j)  {
-
-      a = engine.obs_composite(j);   //  0-based
-
-      a.increment(1);
+   calc_3d_single_atts(obs_clus, obs_raw, config.model.c_str(), config.inten_perc_value, atts);
 
-      mask = obs_obj.select_cluster(a);   //  1-based
+   for (j=0; j<n_clusters; ++j)  {
 
-      att_3 = calc_3d_single_atts(mask, obs_raw, config.model.c_str(), config.inten_perc_value);
+      att_3 = atts[j];
 
       // if ( att.Xvelocity > 20.0 )  mask.write("w.nc");
 
@@ -643,30 +649,19 @@ if ( have_pairs )  {
    //
 
 PairAtt3DArray pa_cluster;
-IntArray b;
 
 if ( have_pairs )  {
 
    mlog << Debug(2)
         << "Calculating 3D cluster pair attributes\n";
 
-   for (j=0; j<n_clusters; ++j)  {
-
-      a = engine.fcst_composite(j);   //  0-based
+   calc_3d_intersection_volumes(fcst_clus, obs_clus, IV);
 
-      a.increment(1);
-
-      fo = fcst_obj.select_cluster(a);   //  1-based
+   for (j=0; j<n_clusters; ++j)  {
 
       for (k=0; k<n_clusters; ++k)  {
 
-         b = engine.obs_composite(k);   //  0-based
-
-         b.increment(1);
-
-         oo = obs_obj.select_cluster(b);   //  1-based
-
-         p = calc_3d_pair_atts(fo, oo, fcst_cluster_att[j], obs_cluster_att[k]);
+         p = calc_3d_pair_atts(IV[j*n_clusters + k], fcst_cluster_att[j], obs_cluster_att[k]);
 
          p.set_cluster();
 
@@ -699,15 +694,9 @@ if ( have_pairs )  {
 
       att_3 = fcst_cluster_att[j];
 
-      a = engine.fcst_composite(j);   //  0-based
-
-      a.increment(1);
-
-      mask = fcst_obj.select_cluster(a);   //  1-based
-
       for (t=(att_3.tmin()); t<=(att_3.tmax()); ++t)  {
 
-         mask_2d = mask.const_t_mask(t, 1);   //  1-based
+         mask_2d = fcst_clus.const_t_mask(t, j + 1);   //  1-based
 
          if (t < 0 || t >= (int)valid_times_fcst.size()) {
             mlog << Error
@@ -747,15 +736,9 @@ if ( have_pairs )  {
 
       att_3 = obs_cluster_att[j];
 
-      a = engine.obs_composite(j);   //  0-based
-
-      a.increment(1);
-
-      mask = obs_obj.select_cluster(a);   //  1-based
-
       for (t=(att_3.tmin()); t<=(att_3.tmax()); ++t)  {
 
-         mask_2d = mask.const_t_mask(t, 1);   //  1-based
+         mask_2d = obs_clus.const_t_mask(t, j + 1);   //  1-based
 
          if (t < 0 || t >= (int)valid_times_obs.size()) {
             mlog << Error
@@ -1167,16 +1150,16 @@ obj.toss_small_objects(config.min_volume);
 int j;
 SingleAtt3D att_3;
 SingleAtt3DArray single_att;
-Object select_mask;
+vector<SingleAtt3D> atts;
 
 mlog << Debug(2)
      << "Calculating 3D fcst single attributes\n";
 
-for (j=0; j<(obj.n_objects()); ++j)  {
+calc_3d_single_atts(obj, raw, config.model.c_str(), config.inten_perc_value, atts);
 
-   select_mask = obj.select(j + 1);   //  1-based
+for (j=0; j<(obj.n_objects()); ++j)  {
 
-   att_3 = calc_3d_single_atts(select_mask, raw, config.model.c_str(), config.inten_perc_value);
+   att_3 = atts[j];
 
    att_3.set_object_number(j + 1);   //  1-based
 
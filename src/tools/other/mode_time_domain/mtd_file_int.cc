@@ -1751,6 +1751,77 @@ return ( s );
 ////////////////////////////////////////////////////////////////////////
 
 
+MtdIntFile MtdIntFile::select_clusters(const vector<IntArray> & clusters) const   //  1-based
+
+{
+
+int j, k, n;
+MtdIntFile s;
+const int n_clusters = (int) clusters.size();
+const int n3 = Nx*Ny*Nt;
+vector<int> label(1 + Nobjects, 0);
+vector<int> V(n_clusters > 0 ? n_clusters : 1, 0);
+
+   //
+   //  map each object number to its (1-based) cluster number
+   //
+
+for (j=0; j<n_clusters; ++j)  {
+
+   const IntArray & a = clusters[j];
+
+   for (k=0; k<(a.n()); ++k)  {
+
+      n = a[k];
+
+      if ( (n < 1) || (n > Nobjects) )  {
+
+         mlog << Error << "\n  MtdIntFile::select_clusters(const vector<IntArray> &) -> range check error\n\n";
+
+         exit ( 1 );
+
+      }
+
+      if ( label[n] != 0 && label[n] != (j + 1) )  {
+
+         mlog << Error << "\n  MtdIntFile::select_clusters(const vector<IntArray> &) -> object "
+              << n << " belongs to more than one cluster\n\n";
+
+         exit ( 1 );
+
+      }
+
+      label[n] = j + 1;
+
+   }
+
+}
+
+s = *this;
+
+s.set_to_zeroes();
+
+const int * in  =   Data;
+      int * out = s.Data;
+
+for (j=0; j<n3; ++j)  {
+
+   k = label[in[j]];
+
+   if ( k )  { out[j] = k;  ++V[k - 1]; }
+
+}
+
+s.set_volumes(n_clusters, V.data());
+
+return ( s );
+
+}
+
+
+////////////////////////////////////////////////////////////////////////
+
+
 int MtdIntFile::x_left(const int y) const
 
 {
@@ -19,6 +19,7 @@
 
 
 #include <iostream>
+#include <vector>
 
 #include "vx_util.h"
 #include "vx_cal.h"
@@ -133,6 +134,10 @@ class MtdIntFile : public MtdFileBase {
       MtdIntFile select         (int)              const;   //  1-based, for selecting simple objects
       MtdIntFile select_cluster (const IntArray &) const;   //  1-based, for selecting cluster objects
 
+         //  relabels each object with its 1-based cluster number, clusters must not overlap
+
+      MtdIntFile select_clusters (const std::vector<IntArray> &) const;
+
       MtdIntFile  const_t_slice (const int t) const;
       MtdIntFile  const_t_mask  (const int t, const int obj_num) const;   //  obj_num is 1-based
 
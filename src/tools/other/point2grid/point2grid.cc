@@ -46,6 +46,7 @@ using namespace netCDF;
 #include "nc_point_obs_in.h"
 
 #include "point2grid_conf_info.h"
+#include "point2grid_cell_mapping.h"
 
 #ifdef WITH_PYTHON
 #include "data2d_nc_met.h"
@@ -160,18 +161,25 @@ static void set_gaussian_dx(const StringArray &);
 static void set_gaussian_radius(const StringArray &);
 
 static unixtime compute_unixtime(NcVar *time_var, unixtime var_value);
-static bool get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
+static bool get_grid_mapping(Grid fr_grid, Grid to_grid, CellMapping &cellMapping,
                              NcVar var_lat, NcVar var_lon, bool *skip_times);
-static bool get_grid_mapping(Grid to_grid, IntArray *cellMapping,
+static bool get_grid_mapping(Grid to_grid, CellMapping &cellMapping,
                              const IntArray obs_index_array, const int *obs_hids,
                              const float *hdr_lats, const float *hdr_lons);
 static int  get_obs_type(NcFile *nc_in);
 static void regrid_nc_variable(NcFile *nc_in, Met2dDataFile *fr_mtddf,
                                VarInfo *vinfo, DataPlane &fr_dp, DataPlane &to_dp,
-                               Grid to_grid, IntArray *cellMapping);
+                               Grid to_grid, const CellMapping &cellMapping);
 
 static bool keep_message_type(const int mt_index);
 
+static ConcatString make_cell_mapping_key(const Grid &to_grid,
+                                          const float *latitudes, int lat_count,
+                                          const float *longitudes, int lon_count,
+                                          int from_lat_count, int from_lon_count,
+                                          bool to_north);
+static ConcatString get_cell_mapping_file(const ConcatString &key);
+
 static bool has_lat_lon_vars(NcFile *nc_in);
 static void set_adp_gc_values(NcVar var_adp_qc);
 
@@ -180,6 +188,7 @@ static void set_adp_gc_values(NcVar var_adp_qc);
 //
 static const int factor_float_to_int = 1000000;
 static const char *key_geostationary_data = "MET_GEOSTATIONARY_DATA";
+static const char *key_regrid_plan_dir = "MET_REGRID_PLAN_DIR";
 static const char *dim_name_lat = "lat";
 static const char *dim_name_lon = "lon";
 static const char *var_name_lat = "latitude";
@@ -194,7 +203,7 @@ static void process_goes_file(NcFile *nc_in, MetConfig &config,
 static unixtime find_valid_time(NcVar time_var);
 static ConcatString get_goes_grid_input(MetConfig config, Grid fr_grid, Grid to_grid);
 static void get_grid_mapping(Grid fr_grid, Grid to_grid,
-                             IntArray *cellMapping, ConcatString geostationary_file);
+                             CellMapping &cellMapping, ConcatString geostationary_file);
 static int  get_lat_count(NcFile *);
 static int  get_lon_count(NcFile *);
 static NcVar get_goes_nc_var(NcFile *nc, const ConcatString var_name,
@@ -204,7 +213,7 @@ static ConcatString make_geostationary_filename(Grid fr_grid, Grid to_grid,
                                                 ConcatString regrid_name);
 static void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
             DataPlane &fr_dp, DataPlane &to_dp,
-            Grid fr_grid, Grid to_grid, IntArray *cellMapping, NcFile *nc_adp);
+            Grid fr_grid, Grid to_grid, const CellMapping &cellMapping, NcFile *nc_adp);
 static void save_geostationary_data(const ConcatString geostationary_file,
             const float *latitudes, const float *longitudes,
             const GoesImagerData grid_data);
@@ -750,7 +759,7 @@ void process_point_met_data(MetPointData *met_point_obs, MetConfig &config, VarI
       // Loop through the requested fields
       int obs_count_zero_to, obs_count_non_zero_to;
       int obs_count_zero_from, obs_count_non_zero_from;
-      IntArray *cellMapping = (IntArray *)0;
+      CellMapping cellMapping;
 
       obs_count_zero_to = obs_count_non_zero_to = 0;
       obs_count_zero_from = obs_count_non_zero_from = 0;
@@ -931,15 +940,11 @@ void process_point_met_data(MetPointData *met_point_obs, MetConfig &config, VarI
             }
          }
 
-         if (cellMapping) {
-            for (idx=0; idx<(nx*ny); idx++) cellMapping[idx].clear();
-            delete [] cellMapping;
-         }
-         cellMapping = new IntArray[nx * ny];
          if( get_grid_mapping(to_grid, cellMapping, var_index_array,
                               obs_data->obs_hids, hdr_lats, hdr_lons) ) {
             int from_index;
-            IntArray cellArray;
+            const int *cellArray;
+            int cell_count;
             NumArray dataArray;
             int offset = 0;
             int valid_count = 0;
@@ -959,17 +964,27 @@ void process_point_met_data(MetPointData *met_point_obs, MetConfig &config, VarI
                prob_mask_dp.set_constant(0);
             }
 
-            for (int x_idx = 0; x_idx<nx; x_idx++) {
-               for (int y_idx = 0; y_idx<ny; y_idx++) {
+            // Each target cell is reduced independently, so thread over
+            // the rows unless every cell is being logged
+#pragma omp parallel for default(shared) \
+              private(from_index, offset, valid_count, data_value, \
+                      cellArray, cell_count, dataArray) \
+              reduction(+:to_count, censored_count, \
+                          obs_count_zero_to, obs_count_non_zero_to) \
+              reduction(min:from_min_value) reduction(max:from_max_value) \
+              schedule (static) if(mlog.verbosity_level() < 8)
+            for (int y_idx = 0; y_idx<ny; y_idx++) {
+               for (int x_idx = 0; x_idx<nx; x_idx++) {
                   offset = to_dp.two_to_one(x_idx,y_idx);
-                  cellArray = cellMapping[offset];
+                  cellArray  = cellMapping.sources(offset);
+                  cell_count = cellMapping.n(offset);
                   int prob_cnt = 0;
                   int prob_value_sum = 0;
-                  if (0 < cellArray.n()) {
+                  if (0 < cell_count) {
                      valid_count = 0;
                      dataArray.clear();
-                     dataArray.extend(cellArray.n());
-                     for (int dIdx=0; dIdx<cellArray.n(); dIdx++) {
+                     dataArray.extend(cell_count);
+                     for (int dIdx=0; dIdx<cell_count; dIdx++) {
                         from_index = cellArray[dIdx];
                         data_value = obs_data->get_obs_val(from_index);
                         if (is_bad_data(data_value)) continue;
@@ -1018,17 +1033,19 @@ void process_point_met_data(MetPointData *met_point_obs, MetConfig &config, VarI
                            prob_mask_dp.set(1, x_idx, y_idx);
                         }
 
-                        if (1 < data_count) {
-                           mlog << Debug(9) << method_name
-                                << " to_value:" << to_value
-                                << " at " << x_idx << "," << y_idx
-                                << ", max: " << dataArray.max()
-                                << ", min: " << dataArray.min()
-                                << ", mean: " << dataArray.sum()/data_count
-                                << " from " << data_count << " data values.\n";
+                        if(mlog.verbosity_level() >= 8) {
+                           if (1 < data_count) {
+                              mlog << Debug(9) << method_name
+                                   << " to_value:" << to_value
+                                   << " at " << x_idx << "," << y_idx
+                                   << ", max: " << dataArray.max()
+                                   << ", min: " << dataArray.min()
+                                   << ", mean: " << dataArray.sum()/data_count
+                                   << " from " << data_count << " data values.\n";
+                           }
+                           mlog << Debug(8) << method_name << "data at " << x_idx << "," << y_idx
+                                << ", value: " << to_value << "\n";
                         }
-                        mlog << Debug(8) << method_name << "data at " << x_idx << "," << y_idx
-                             << ", value: " << to_value << "\n";
                      }
                   }
                }
@@ -1132,9 +1149,6 @@ void process_point_met_data(MetPointData *met_point_obs, MetConfig &config, VarI
          }
       } // end for i
 
-      if (cellMapping) {
-         delete [] cellMapping;   cellMapping = (IntArray *)0;
-      }
    }
 
    delete [] hdr_lats;
@@ -1302,7 +1316,7 @@ void process_point_nccf_file(NcFile *nc_in, MetConfig &config,
       else valid_time = find_valid_time(time_var);
    }
    to_dp.set_size(to_grid.nx(), to_grid.ny());
-   IntArray *cellMapping = new IntArray[to_grid.nx() * to_grid.ny()];
+   CellMapping cellMapping;
    get_grid_mapping(fr_grid, to_grid, cellMapping, var_lat, var_lon, skip_times);
    if( skip_times ) delete [] skip_times;
    if( valid_times ) delete [] valid_times;
@@ -1386,8 +1400,6 @@ void process_point_nccf_file(NcFile *nc_in, MetConfig &config,
 
    } // end for i
 
-   delete [] cellMapping;
-   cellMapping = (IntArray *)0;
    if( 0 < filtered_by_time ) {
       mlog << Debug(2) << method_name << "Filtered by time: " << filtered_by_time
            << " out of " << from_size
@@ -1404,7 +1416,7 @@ void process_point_nccf_file(NcFile *nc_in, MetConfig &config,
 
 void regrid_nc_variable(NcFile *nc_in, Met2dDataFile *fr_mtddf,
                         VarInfo *vinfo, DataPlane &fr_dp, DataPlane &to_dp,
-                        Grid to_grid, IntArray *cellMapping) {
+                        Grid to_grid, const CellMapping &cellMapping) {
 
    int to_cell_cnt = 0;
    clock_t start_clock =  clock();
@@ -1447,7 +1459,8 @@ void regrid_nc_variable(NcFile *nc_in, Met2dDataFile *fr_mtddf,
       int missing_cnt = 0;
       int non_missing_cnt = 0;
       float data_value;
-      IntArray cellArray;
+      const int *cellArray;
+      int cell_count;
       NumArray dataArray;
       float from_min_value =  10e10;
       float from_max_value = -10e10;
@@ -1457,14 +1470,22 @@ void regrid_nc_variable(NcFile *nc_in, Met2dDataFile *fr_mtddf,
       missing_cnt = non_missing_cnt = 0;
       to_dp.set_constant(bad_data_double);
       
-      for (int xIdx=0; xIdx<to_lon_cnt; xIdx++) {
-         for (int yIdx=0; yIdx<to_lat_cnt; yIdx++) {
+      // Each target cell is reduced independently, so thread over the
+      // rows unless every cell is being logged
+#pragma omp parallel for default(shared) \
+        private(from_index, data_value, cellArray, cell_count, dataArray) \
+        reduction(+:to_cell_cnt, missing_cnt, non_missing_cnt, no_map_cnt) \
+        reduction(min:from_min_value) reduction(max:from_max_value) \
+        schedule (static) if(mlog.verbosity_level() < 9)
+      for (int yIdx=0; yIdx<to_lat_cnt; yIdx++) {
+         for (int xIdx=0; xIdx<to_lon_cnt; xIdx++) {
             int offset = to_dp.two_to_one(xIdx,yIdx);
-            cellArray = cellMapping[offset];
-            if (0 < cellArray.n()) {
+            cellArray  = cellMapping.sources(offset);
+            cell_count = cellMapping.n(offset);
+            if (0 < cell_count) {
                dataArray.clear();
-               dataArray.extend(cellArray.n());
-               for (int dIdx=0; dIdx<cellArray.n(); dIdx++) {
+               dataArray.extend(cell_count);
+               for (int dIdx=0; dIdx<cell_count; dIdx++) {
                   from_index = cellArray[dIdx];
                   data_value = from_data[from_index];
                   if (is_bad_data(data_value)) {
@@ -1510,7 +1531,7 @@ void regrid_nc_variable(NcFile *nc_in, Met2dDataFile *fr_mtddf,
                              << ", max: " << dataArray.max()
                              << ", min: " << dataArray.min()
                              << ", mean: " << dataArray.sum()/data_cnt
-                             << " from " << data_cnt << " (out of " << cellArray.n()
+                             << " from " << data_cnt << " (out of " << cell_count
                              << ") data values to (" << to_lon << ", " << to_lat << ").\n";
                   }
                }
@@ -1712,7 +1733,7 @@ void process_goes_file(NcFile *nc_in, MetConfig &config, VarInfo *vinfo,
    unixtime valid_time = find_valid_time(time_var);
    to_dp.set_size(to_grid.nx(), to_grid.ny());
    global_attr_count =  sizeof(GOES_global_attr_names)/sizeof(*GOES_global_attr_names);
-   IntArray *cellMapping = new IntArray[to_grid.nx() * to_grid.ny()];
+   CellMapping cellMapping;
    get_grid_mapping(fr_grid, to_grid, cellMapping, geostationary_file);
 
    // Loop through the requested fields
@@ -1816,7 +1837,6 @@ void process_goes_file(NcFile *nc_in, MetConfig &config, VarInfo *vinfo,
    //copy_nc_atts(_nc_in, nc_out, opt_all_attrs);
 
    delete nc_adp; nc_adp = 0;
-   delete [] cellMapping;   cellMapping = (IntArray *)0;
    mlog << Debug(LEVEL_FOR_PERFORMANCE) << method_name << "took "
         << (clock()-start_clock)/double(CLOCKS_PER_SEC) << " seconds\n";
 
@@ -1901,13 +1921,16 @@ static unixtime compute_unixtime(NcVar *time_var, unixtime var_value) {
 
 ////////////////////////////////////////////////////////////////////////
 
-static bool get_grid_mapping(Grid to_grid, IntArray *cellMapping,
+static bool get_grid_mapping(Grid to_grid, CellMapping &cellMapping,
                              const IntArray obs_index_array, const int *obs_hids,
                              const float *hdr_lats, const float *hdr_lons) {
    bool status = false;
    clock_t start_clock =  clock();
    static const char *method_name = "get_grid_mapping(MET_obs) -> ";
 
+   // Start with no sources mapped to any cell
+   cellMapping.set(to_grid.nx() * to_grid.ny(), vector<int>());
+
    int obs_count = obs_index_array.n();
    if (0 == obs_count) {
       mlog << Warning << "\n" << method_name
@@ -1924,10 +1947,13 @@ static bool get_grid_mapping(Grid to_grid, IntArray *cellMapping,
    int to_lat_count = to_grid.ny();
    int to_lon_count = to_grid.nx();
 
+   vector<int> src_index(obs_count), to_cell(obs_count, bad_data_int);
+
    count_in_grid = 0;
    to_dp.set_size(to_lon_count, to_lat_count);
    for (int idx=0; idx<obs_count; idx++) {
       obs_idx = obs_index_array[idx];
+      src_index[idx] = obs_idx;
       hdr_idx = obs_hids[obs_idx];
       lat = hdr_lats[hdr_idx];
       lon = hdr_lons[hdr_idx];
@@ -1937,10 +1963,11 @@ static bool get_grid_mapping(Grid to_grid, IntArray *cellMapping,
       idx_y = nint(y);
       if (0 <= idx_x && idx_x < to_lon_count && 0 <= idx_y && idx_y < to_lat_count) {
          to_offset = to_dp.two_to_one(idx_x, idx_y);
-         cellMapping[to_offset].add(obs_idx);
+         to_cell[idx] = to_offset;
          count_in_grid++;
       }
    }
+   cellMapping.set(to_lon_count * to_lat_count, src_index, to_cell);
 
    if (0 == count_in_grid)
       mlog << Warning << "\n" << method_name
@@ -1960,8 +1987,8 @@ static bool get_grid_mapping(Grid to_grid, IntArray *cellMapping,
 ////////////////////////////////////////////////////////////////////////
 
 static void get_grid_mapping_latlon(
-      DataPlane from_dp, DataPlane to_dp, Grid to_grid,
-      IntArray *cellMapping, float *latitudes, float *longitudes,
+      const DataPlane &from_dp, const DataPlane &to_dp, const Grid &to_grid,
+      CellMapping &cellMapping, float *latitudes, float *longitudes,
       int from_lat_count, int from_lon_count, bool *skip_times, bool to_north, bool is_2d) {
    double x, y;
    double to_ll_lat, to_ll_lon;
@@ -1975,10 +2002,30 @@ static void get_grid_mapping_latlon(
    int data_size  = from_lat_count * from_lon_count;
    static const char *method_name = "get_grid_mapping(lats, lons) -> ";
 
-   int *to_cell_counts = new int[to_size];
-   int *mapping_indices = new int[data_size];
-   for (int xIdx=0; xIdx<to_size; xIdx++) to_cell_counts[xIdx] = 0;
-   for (int xIdx=0; xIdx<data_size; xIdx++) mapping_indices[xIdx] = bad_data_int;
+   // Reuse the cell mapping from a previous run, unless some of the
+   // coordinates are skipped by the time filter
+   bool use_mapping_file = true;
+   if (is_2d && skip_times != 0) {
+      for (int i=0; i<data_size; i++) {
+         if (skip_times[i]) { use_mapping_file = false; break; }
+      }
+   }
+   ConcatString mapping_key, mapping_file;
+   if (use_mapping_file) {
+      mapping_key = make_cell_mapping_key(to_grid,
+                       latitudes,  (is_2d ? data_size : from_lat_count),
+                       longitudes, (is_2d ? data_size : from_lon_count),
+                       from_lat_count, from_lon_count, to_north);
+      mapping_file = get_cell_mapping_file(mapping_key);
+      if (!mapping_file.empty() &&
+          cellMapping.read(mapping_file.c_str(), mapping_key.text(), to_size, data_size)) {
+         mlog << Debug(3) << method_name << "read the cell mapping from "
+              << mapping_file << "\n";
+         return;
+      }
+   }
+
+   vector<int> mapping_indices(data_size, bad_data_int);
 
    to_grid.xy_to_latlon(0, 0, to_ll_lat, to_ll_lon);
    mlog << Debug(5) << method_name << " to_grid ll corner: (" << to_ll_lon << ", " << to_ll_lat << ")\n";
@@ -2003,7 +2050,6 @@ static void get_grid_mapping_latlon(
          if (0 <= idx_x && idx_x < to_lon_count && 0 <= idx_y && idx_y < to_lat_count) {
             to_offset = to_dp.two_to_one(idx_x, idx_y);
             mapping_indices[coord_offset] = to_offset;
-            to_cell_counts[to_offset] += 1;
             count_in_grid++;
             if(mlog.verbosity_level() >= 15) {
                double to_lat, to_lon;
@@ -2017,44 +2063,19 @@ static void get_grid_mapping_latlon(
    mlog << Debug(LEVEL_FOR_PERFORMANCE+2) << method_name << "took "
         << (clock()-start_clock)/double(CLOCKS_PER_SEC) << " seconds for mapping cells\n";
 
-   // Count the mapping cells for each to_cell and prepare IntArray
-   int max_count = 0;
+   // Build the cell mapping, keeping the sources in each cell in order
    clock_t tmp_clock =  clock();
-   for (int xIdx=0; xIdx<to_size; xIdx++) {
-      int cell_count = to_cell_counts[xIdx];
-      if( cell_count > 0 ) {
-         cellMapping[xIdx].extend(cell_count+1);
-         if( cell_count > 32768 ) {
-            mlog << Debug(LEVEL_FOR_PERFORMANCE+1) << method_name
-                 << "extent IntArray to " << cell_count << " at " << xIdx << "\n";
-         }
-         if( max_count < cell_count ) max_count = cell_count;
-      }
-      else if( cell_count < 0 ) {
-         mlog << Error << "\n" << method_name
-              << "the mapping cell count can not be negative "
-              << cell_count << " at " << xIdx << "\n\n";
-         exit(1);
-      }
-   }
+   cellMapping.set(to_size, mapping_indices);
    mlog << Debug(LEVEL_FOR_PERFORMANCE+1) << method_name << "took "
         << (clock()-tmp_clock)/double(CLOCKS_PER_SEC)
-        << " seconds for extending IntArray (max_cells=" << max_count << ")\n";
+        << " seconds for building cell mapping (max_cells="
+        << cellMapping.max_count() << ")\n";
 
-   // Build cell mapping
-   for (int xIdx=0; xIdx<data_size; xIdx++) {
-      to_offset = mapping_indices[xIdx];
-      if( is_bad_data(to_offset) ) continue;
-      if( to_offset < 0 || to_offset >= to_size ) {
-         mlog << Error << "\n" << method_name
-              << "the mapped cell is out of range: "
-              << to_offset << " at " << xIdx << "\n\n";
-         exit(1);
-      }
-      else cellMapping[to_offset].add(xIdx);
+   if (!mapping_file.empty() &&
+       cellMapping.write(mapping_file.c_str(), mapping_key.text())) {
+      mlog << Debug(3) << method_name << "wrote the cell mapping to "
+           << mapping_file << "\n";
    }
-   delete [] to_cell_counts;
-   delete [] mapping_indices;
 
    mlog << Debug(3) << method_name << "within grid: " << count_in_grid
         << " out of " << data_size << " (" << 1.0*count_in_grid/data_size*100 << "%)\n";
@@ -2062,9 +2083,61 @@ static void get_grid_mapping_latlon(
         << (clock()-start_clock)/double(CLOCKS_PER_SEC) << " seconds\n";
 }
 
+////////////////////////////////////////////////////////////////////////
+//
+// The key identifies the target grid, the source dimensions, and the
+// source coordinates through a hash of their values.
+//
+////////////////////////////////////////////////////////////////////////
+
+static ConcatString make_cell_mapping_key(const Grid &to_grid,
+                                          const float *latitudes, int lat_count,
+                                          const float *longitudes, int lon_count,
+                                          int from_lat_count, int from_lon_count,
+                                          bool to_north) {
+   double lat, lon;
+   ConcatString key, cs;
+   const int nx = to_grid.nx();
+   const int ny = to_grid.ny();
+   const int xs[] = { 0, nx - 1, 0,      nx - 1, nx/2 };
+   const int ys[] = { 0, 0,      ny - 1, ny - 1, ny/2 };
+
+   key << "to " << to_grid.serialize();
+   for (int i=0; i<(int) (sizeof(xs)/sizeof(*xs)); i++) {
+      to_grid.xy_to_latlon(xs[i], ys[i], lat, lon);
+      cs.format(" (%d,%d)->(%.10f,%.10f)", xs[i], ys[i], lat, lon);
+      key << cs;
+   }
+   cs.format(" from %dx%d north %d lat %d %016llx lon %d %016llx",
+             from_lon_count, from_lat_count, (to_north ? 1 : 0),
+             lat_count, fnv1a_hash(latitudes, lat_count*sizeof(float)),
+             lon_count, fnv1a_hash(longitudes, lon_count*sizeof(float)));
+   key << cs;
+
+   return key;
+}
+
+////////////////////////////////////////////////////////////////////////
+//
+// Cell mappings are stored in the MET_REGRID_PLAN_DIR directory, when
+// set, and named using a hash of the key.
+//
 ////////////////////////////////////////////////////////////////////////
 
-static bool get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
+static ConcatString get_cell_mapping_file(const ConcatString &key) {
+   ConcatString dir, path;
+
+   if (!get_env(key_regrid_plan_dir, dir) || dir.empty()) return path;
+
+   path.format("%s/point2grid_mapping_%016llx.bin", dir.c_str(),
+               fnv1a_hash(key.c_str()));
+
+   return path;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+static bool get_grid_mapping(Grid fr_grid, Grid to_grid, CellMapping &cellMapping,
                              NcVar var_lat, NcVar var_lon, bool *skip_times) {
    bool status = false;
    DataPlane from_dp, to_dp;
@@ -2086,6 +2159,7 @@ static bool get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
 
    from_dp.set_size(from_lon_count, from_lat_count);
    to_dp.set_size(to_lon_count, to_lat_count);
+   cellMapping.set(to_lon_count * to_lat_count, vector<int>());
 
    if (IS_INVALID_NC(var_lat)) {
       mlog << Error << "\n" << method_name
@@ -2180,7 +2254,7 @@ ConcatString get_goes_grid_input(MetConfig config, Grid fr_grid, Grid to_grid) {
 
 ////////////////////////////////////////////////////////////////////////
 
-void get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
+void get_grid_mapping(Grid fr_grid, Grid to_grid, CellMapping &cellMapping,
                       ConcatString geostationary_file) {
    static const char *method_name = "get_grid_mapping() -> ";
    DataPlane from_dp, to_dp;
@@ -2226,6 +2300,7 @@ void get_grid_mapping(Grid fr_grid, Grid to_grid, IntArray *cellMapping,
 
    from_dp.set_size(from_lon_count, from_lat_count);
    to_dp.set_size(to_lon_count, to_lat_count);
+   cellMapping.set(to_lon_count * to_lat_count, vector<int>());
 
    if (data_size > 0) {
       int lat_count = data_size;
@@ -2452,7 +2527,7 @@ static bool is_time_mismatch(NcFile *nc_in, NcFile *nc_adp) {
 
 void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
       DataPlane &fr_dp, DataPlane &to_dp,
-      Grid fr_grid, Grid to_grid, IntArray *cellMapping, NcFile *nc_adp) {
+      Grid fr_grid, Grid to_grid, const CellMapping &cellMapping, NcFile *nc_adp) {
 
    bool has_qc_var = false;
    bool has_adp_qc_var = false;
@@ -2563,7 +2638,8 @@ void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
    float from_max_value = -10e10;
    float qc_min_value =  10e10;
    float qc_max_value = -10e10;
-   IntArray cellArray;
+   const int *cellArray;
+   int cell_count;
    NumArray dataArray;
    int particle_qc;
    bool has_qc_flags = (qc_flags.n() > 0);
@@ -2585,15 +2661,30 @@ void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
    int cnt_adp_qc_high_to_low = 0;
    int cnt_adp_qc_high_to_medium = 0;
    int cnt_adp_qc_medium_to_low = 0;
-   for (int xIdx=0; xIdx<to_lon_count; xIdx++) {
-      for (int yIdx=0; yIdx<to_lat_count; yIdx++) {
+
+   // Each target cell is reduced independently, so thread over the
+   // rows unless every cell is being logged
+#pragma omp parallel for default(shared) \
+        private(from_index, qc_value, cellArray, cell_count, dataArray) \
+        reduction(+:absent_count, censored_count, missing_count, to_cell_count, \
+                    non_missing_count, qc_filtered_count, adp_qc_filtered_count, \
+                    cnt_aod_qc_low, cnt_aod_qc_high, cnt_aod_qc_medium, cnt_aod_qc_nr, \
+                    cnt_adp_qc_low, cnt_adp_qc_high, cnt_adp_qc_medium, cnt_adp_qc_nr, \
+                    cnt_adp_qc_high_to_low, cnt_adp_qc_high_to_medium, \
+                    cnt_adp_qc_medium_to_low) \
+        reduction(min:from_min_value, qc_min_value) \
+        reduction(max:from_max_value, qc_max_value) \
+        schedule (static) if(mlog.verbosity_level() < 9)
+   for (int yIdx=0; yIdx<to_lat_count; yIdx++) {
+      for (int xIdx=0; xIdx<to_lon_count; xIdx++) {
          int offset = to_dp.two_to_one(xIdx,yIdx);
-         cellArray = cellMapping[offset];
-         if (0 < cellArray.n()) {
+         cellArray  = cellMapping.sources(offset);
+         cell_count = cellMapping.n(offset);
+         if (0 < cell_count) {
             int valid_count = 0;
             dataArray.clear();
-            dataArray.extend(cellArray.n());
-            for (int dIdx=0; dIdx<cellArray.n(); dIdx++) {
+            dataArray.extend(cell_count);
+            for (int dIdx=0; dIdx<cell_count; dIdx++) {
                from_index = cellArray[dIdx];
                float data_value = from_data[from_index];
                if (is_bad_data(data_value)) {
@@ -2692,12 +2783,14 @@ void regrid_goes_variable(NcFile *nc_in, VarInfo *vinfo,
 
                to_dp.set(to_value, xIdx, yIdx);
                to_cell_count++;
-               mlog << Debug(9) << method_name
-                    <<   "max: " << dataArray.max()
-                    << ", min: " << dataArray.min()
-                    << ", mean: " << dataArray.sum()/data_count
-                    << " from " << valid_count << " out of "
-                    << data_count << " data values.\n";
+               if(mlog.verbosity_level() >= 9) {
+                  mlog << Debug(9) << method_name
+                       <<   "max: " << dataArray.max()
+                       << ", min: " << dataArray.min()
+                       << ", mean: " << dataArray.sum()/data_count
+                       << " from " << valid_count << " out of "
+                       << data_count << " data values.\n";
+               }
             }
          }
       }
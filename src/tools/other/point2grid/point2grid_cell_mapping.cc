@@ -0,0 +1,219 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+using namespace std;
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+
+#include "point2grid_cell_mapping.h"
+#include "vx_log.h"
+#include "temp_file.h"
+
+////////////////////////////////////////////////////////////////////////
+
+static const char cell_mapping_magic[] = "MET_POINT2GRID_MAPPING";
+static const int  cell_mapping_version = 1;
+
+////////////////////////////////////////////////////////////////////////
+//
+//  Code for class CellMapping
+//
+////////////////////////////////////////////////////////////////////////
+
+CellMapping::CellMapping() {
+
+   init_from_scratch();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+CellMapping::~CellMapping() {
+
+   clear();
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void CellMapping::init_from_scratch() {
+
+   clear();
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void CellMapping::clear() {
+
+   NCells = 0;
+   CellStart.assign(1, 0);
+   vector<int>().swap(Source);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void CellMapping::set(int n_cells, const vector<int> &to_cell) {
+   vector<int> src_index;
+
+   src_index.reserve(to_cell.size());
+   for(int i=0; i<(int) to_cell.size(); i++) src_index.push_back(i);
+
+   set(n_cells, src_index, to_cell);
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+void CellMapping::set(int n_cells, const vector<int> &src_index,
+                      const vector<int> &to_cell) {
+   int i, cell;
+   vector<int> next;
+
+   if(src_index.size() != to_cell.size()) {
+      mlog << Error << "\nCellMapping::set() -> "
+           << "the number of source indices (" << src_index.size()
+           << ") and target cells (" << to_cell.size()
+           << ") do not match.\n\n";
+      exit(1);
+   }
+
+   NCells = n_cells;
+
+   // Count the sources mapped to each cell
+   CellStart.assign(NCells + 1, 0);
+   for(i=0; i<(int) to_cell.size(); i++) {
+      cell = to_cell[i];
+      if(cell < 0) continue;
+      if(cell >= NCells) {
+         mlog << Error << "\nCellMapping::set() -> "
+              << "the mapped cell is out of range: "
+              << cell << " at " << src_index[i] << "\n\n";
+         exit(1);
+      }
+      CellStart[cell+1]++;
+   }
+
+   // Convert the counts to offsets
+   for(i=0; i<NCells; i++) CellStart[i+1] += CellStart[i];
+
+   // Fill in the sources, preserving their order within each cell
+   Source.resize(CellStart[NCells]);
+   next.assign(CellStart.begin(), CellStart.end()-1);
+   for(i=0; i<(int) to_cell.size(); i++) {
+      cell = to_cell[i];
+      if(cell < 0) continue;
+      Source[next[cell]++] = src_index[i];
+   }
+
+   return;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+int CellMapping::max_count() const {
+   int max_n = 0;
+
+   for(int i=0; i<NCells; i++) {
+      if(n(i) > max_n) max_n = n(i);
+   }
+
+   return(max_n);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool CellMapping::read(const char *path, const string &key,
+                       int n_cells, int n_sources) {
+   char magic[sizeof(cell_mapping_magic)];
+   int i, version = 0, n_key = 0, n_file_cells = 0, n_source = 0;
+   bool status;
+
+   ifstream in(path, ios::in | ios::binary);
+   if(!in) return(false);
+
+   in.read(magic, sizeof(magic));
+   in.read((char *) &version, sizeof(version));
+   in.read((char *) &n_key, sizeof(n_key));
+   if(!in || strncmp(magic, cell_mapping_magic, sizeof(magic)) != 0 ||
+      version != cell_mapping_version ||
+      n_key != (int) key.length()) return(false);
+
+   vector<char> key_buf(n_key);
+   if(n_key > 0) in.read(key_buf.data(), n_key);
+   in.read((char *) &n_file_cells, sizeof(n_file_cells));
+   in.read((char *) &n_source, sizeof(n_source));
+   if(!in || key != string(key_buf.begin(), key_buf.end()) ||
+      n_file_cells != n_cells || n_source < 0) return(false);
+
+   NCells = n_cells;
+   CellStart.resize(NCells + 1);
+   Source.resize(n_source);
+   in.read((char *) CellStart.data(), CellStart.size()*sizeof(int));
+   if(n_source > 0) in.read((char *) Source.data(), n_source*sizeof(int));
+
+   // The offsets must increase and the sources must be in range
+   status = (bool) in && CellStart[0] == 0 && CellStart[NCells] == n_source;
+   for(i=0; status && i<NCells; i++) {
+      if(CellStart[i+1] < CellStart[i]) status = false;
+   }
+   for(i=0; status && i<n_source; i++) {
+      if(Source[i] < 0 || Source[i] >= n_sources) status = false;
+   }
+
+   if(!status) {
+      mlog << Debug(3) << "CellMapping::read() -> "
+           << "ignoring cell mapping file \"" << path
+           << "\" which does not match the grids.\n";
+      clear();
+   }
+
+   return(status);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+bool CellMapping::write(const char *path, const string &key) const {
+   int n_key = key.length();
+   int n_source = Source.size();
+   ConcatString tmp_path = make_temp_file_name(path, nullptr);
+
+   ofstream out(tmp_path.c_str(), ios::out | ios::binary);
+   if(!out) {
+      mlog << Debug(3) << "CellMapping::write() -> "
+           << "unable to write cell mapping file \"" << path << "\".\n";
+      return(false);
+   }
+
+   out.write(cell_mapping_magic, sizeof(cell_mapping_magic));
+   out.write((const char *) &cell_mapping_version, sizeof(cell_mapping_version));
+   out.write((const char *) &n_key, sizeof(n_key));
+   out.write(key.c_str(), n_key);
+   out.write((const char *) &NCells, sizeof(NCells));
+   out.write((const char *) &n_source, sizeof(n_source));
+   out.write((const char *) CellStart.data(), CellStart.size()*sizeof(int));
+   if(n_source > 0) out.write((const char *) Source.data(), n_source*sizeof(int));
+   out.close();
+
+   if(!out || rename(tmp_path.c_str(), path) != 0) {
+      mlog << Debug(3) << "CellMapping::write() -> "
+           << "unable to write cell mapping file \"" << path << "\".\n";
+      remove(tmp_path.c_str());
+      return(false);
+   }
+
+   return(true);
+}
+
+////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,102 @@
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+// ** Copyright UCAR (c) 1992 - 2023
+// ** University Corporation for Atmospheric Research (UCAR)
+// ** National Center for Atmospheric Research (NCAR)
+// ** Research Applications Lab (RAL)
+// ** P.O.Box 3000, Boulder, Colorado, 80307-3000, USA
+// *=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*=*
+
+////////////////////////////////////////////////////////////////////////
+
+#ifndef  __POINT_TO_GRID_CELL_MAPPING_H__
+#define  __POINT_TO_GRID_CELL_MAPPING_H__
+
+////////////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////
+//
+// Mapping from each target grid cell to the source indices which fall
+// inside it, stored in compressed sparse row form: the sources for
+// cell n are Source[CellStart[n]] through Source[CellStart[n+1]-1],
+// in the order they were added.
+//
+// The mapping can be written to and read from a binary file, tagged
+// with a key which identifies the grids and coordinates it was built
+// from.
+//
+////////////////////////////////////////////////////////////////////////
+
+class CellMapping {
+
+   private:
+
+      void init_from_scratch();
+
+      int NCells;
+
+      std::vector<int> CellStart;
+      std::vector<int> Source;
+
+   public:
+
+      CellMapping();
+     ~CellMapping();
+
+      void clear();
+
+         //
+         //  set stuff
+         //
+
+         // to_cell[i] is the target cell for source i, or negative
+         // (or bad data) if the source is not mapped
+      void set(int n_cells, const std::vector<int> &to_cell);
+
+         // to_cell[i] is the target cell for source src_index[i]
+      void set(int n_cells, const std::vector<int> &src_index,
+               const std::vector<int> &to_cell);
+
+         //
+         //  get stuff
+         //
+
+      int n_cells()     const;
+      int n_mapped()    const;
+      int max_count()   const;
+
+      int         n      (int cell) const;
+      const int * sources(int cell) const;
+
+         //
+         //  do stuff
+         //
+
+         // read fails unless the key, the number of cells, and the
+         // range of the source indices all match
+      bool read (const char *path, const std::string &key,
+                 int n_cells, int n_sources);
+      bool write(const char *path, const std::string &key) const;
+
+};
+
+////////////////////////////////////////////////////////////////////////
+
+inline int CellMapping::n_cells()  const { return(NCells); }
+inline int CellMapping::n_mapped() const { return((int) Source.size()); }
+
+inline int CellMapping::n(int cell) const {
+   return(CellStart[cell+1] - CellStart[cell]);
+}
+
+inline const int * CellMapping::sources(int cell) const {
+   return(Source.data() + CellStart[cell]);
+}
+
+////////////////////////////////////////////////////////////////////////
+
+#endif   /*  __POINT_TO_GRID_CELL_MAPPING_H__  */
+
+////////////////////////////////////////////////////////////////////////